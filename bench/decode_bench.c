@@ -0,0 +1,225 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    decode_bench.c
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added frame decoder benchmark
+ *                  | v1.1.0 - Writing of the frames as a capture trace
+ *
+ * @note    Feeds synthetic pulse trains to the fixed threshold decoding used
+ *          before (first DHT_PULSES * 2 widths, 48us or mean low threshold)
+ *          and to dht_decode_frame, and reports how many frames each decodes
+ *          correctly and the time per frame. No GPIO is involved.
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "dht_decoder.h"
+#include "dht_trace.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+typedef struct BENCH_CFG {
+    int frames;
+    float jitter_us;                        // Uniform jitter of every level
+    float glitch_rate;                      // Sub-microsecond glitch per bit
+    float stretch_rate;                     // Low level stretched 3x per frame
+    float junk_rate;                        // Stray pulse before the preamble
+    float loops_per_us;                     // 0 for microseconds
+    uint32_t seed;
+} bench_cfg_t;
+
+typedef struct BENCH_RESULT {
+    int good;                               // Decoded to the sent frame
+    int wrong;                              // Valid checksum, wrong frame
+    double ns;                              // Decode time
+} bench_result_t;
+
+static uint32_t bench_state;
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static uint32_t bench_random(void) {
+    bench_state ^= bench_state << 13;
+    bench_state ^= bench_state >> 17;
+    bench_state ^= bench_state << 5;
+    return bench_state;
+}
+
+static float bench_uniform(void) {
+    return (bench_random() >> 8) / 16777216.0f;
+}
+
+static double bench_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void bench_push(const bench_cfg_t *cfg, uint32_t *widths, int *count, float us) {
+    if(*count >= DHT_RUNS_MAX) { return; }
+
+    us += (bench_uniform() * 2.0f - 1.0f) * cfg->jitter_us;
+    if(us < 0.0f) { us = 0.0f; }
+    widths[(*count)++] = cfg->loops_per_us > 0.0f ? (uint32_t) (us * cfg->loops_per_us) : (uint32_t) us;
+}
+
+static int bench_frame(const bench_cfg_t *cfg, uint8_t data[5], uint32_t *widths) {
+    data[0] = 20 + bench_random() % 70;
+    data[1] = bench_random() % 10;
+    data[2] = bench_random() % 50;
+    data[3] = bench_random() % 10;
+    data[4] = (data[0] + data[1] + data[2] + data[3]) & 0xFF;
+
+    int count = 0;
+    if(bench_uniform() < cfg->junk_rate) {
+        bench_push(cfg, widths, &count, 6.0f);
+        bench_push(cfg, widths, &count, 12.0f);
+    }
+    bench_push(cfg, widths, &count, 80.0f);
+    bench_push(cfg, widths, &count, 80.0f);
+
+    int stretched = bench_uniform() < cfg->stretch_rate ? (int) (bench_random() % 40) : -1;
+    for(int b = 0; b < 40; b++) {
+        int bit = (data[b / 8] >> (7 - b % 8)) & 1;
+        bench_push(cfg, widths, &count, b == stretched ? 150.0f : 50.0f);
+
+        float high = bit ? 70.0f : 27.0f;
+        if(bench_uniform() < cfg->glitch_rate) {
+            // Line dips for a fraction of a microsecond inside the high level
+            float at = high * bench_uniform();
+            bench_push(cfg, widths, &count, at);
+            if(count < DHT_RUNS_MAX) { widths[count++] = 0; }
+            bench_push(cfg, widths, &count, high - at);
+        } else {
+            bench_push(cfg, widths, &count, high);
+        }
+    }
+    bench_push(cfg, widths, &count, 50.0f);
+    return count;
+}
+
+static int bench_legacy(const bench_cfg_t *cfg, const uint32_t *widths, int count, uint8_t data[5]) {
+    if(count < (int) DHT_PULSES * 2) { return DHT_ERR_TIMEOUT; }
+
+    uint32_t threshold = DHT_BIT_THRESHOLD_US;
+    if(cfg->loops_per_us > 0.0f) {
+        threshold = 0;
+        for(uint32_t i = 2; i < DHT_PULSES * 2; i+=2) {
+            threshold += widths[i];
+        }
+        threshold /= DHT_PULSES - 1;
+    }
+    dht_decode_pulses(widths, threshold, data);
+
+    uint8_t csum = (data[0] + data[1] + data[2] + data[3]) & 0xFF;
+    return csum == data[4] ? DHT_SUCCESS : DHT_ERR_CHECKSUM;
+}
+
+static void bench_usage(const char *name) {
+    fprintf(stderr,
+        "Usage: %s [options]\n"
+        "  -n <frames>   Number of frames (default 100000)\n"
+        "  -j <us>       Jitter of every level in microseconds (default 4)\n"
+        "  -g <rate>     Glitch probability per bit (default 0.002)\n"
+        "  -x <rate>     Stretched low level probability per frame (default 0.05)\n"
+        "  -p <rate>     Stray pulse before the preamble per frame (default 0.02)\n"
+        "  -l <loops>    Widths in loop counts per microsecond (default 0, us)\n"
+        "  -s <seed>     Random seed (default 1)\n"
+        "  -o <trace>    Also write the frames to a trace for dht_replay\n",
+        name);
+}
+
+int main(int argc, char **argv) {
+    bench_cfg_t cfg = {
+        .frames = 100000,
+        .jitter_us = 4.0f,
+        .glitch_rate = 0.002f,
+        .stretch_rate = 0.05f,
+        .junk_rate = 0.02f,
+        .loops_per_us = 0.0f,
+        .seed = 1,
+    };
+
+    const char *trace = NULL;
+    int opt;
+    while((opt = getopt(argc, argv, "n:j:g:x:p:l:s:o:h")) != -1) {
+        switch(opt) {
+        case 'n': cfg.frames = atoi(optarg); break;
+        case 'j': cfg.jitter_us = atof(optarg); break;
+        case 'g': cfg.glitch_rate = atof(optarg); break;
+        case 'x': cfg.stretch_rate = atof(optarg); break;
+        case 'p': cfg.junk_rate = atof(optarg); break;
+        case 'l': cfg.loops_per_us = atof(optarg); break;
+        case 's': cfg.seed = (uint32_t) strtoul(optarg, NULL, 0); break;
+        case 'o': trace = optarg; break;
+        default: bench_usage(argv[0]); return EXIT_FAILURE;
+        }
+    }
+    if(cfg.frames <= 0) {
+        bench_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if(trace != NULL && dht_trace_open(trace) != DHT_SUCCESS) {
+        fprintf(stderr, "Failed to open trace %s\n", trace);
+        return EXIT_FAILURE;
+    }
+
+    bench_state = cfg.seed != 0 ? cfg.seed : 1;
+    const uint32_t tpus = cfg.loops_per_us > 0.0f ? 0 : 1;
+
+    bench_result_t legacy = { 0 };
+    bench_result_t robust = { 0 };
+    double confidence = 0.0;
+    for(int f = 0; f < cfg.frames; f++) {
+        uint8_t sent[5];
+        uint32_t widths[DHT_RUNS_MAX];
+        int count = bench_frame(&cfg, sent, widths);
+
+        uint8_t data[5];
+        double start = bench_now_ns();
+        int result = bench_legacy(&cfg, widths, count, data);
+        legacy.ns += bench_now_ns() - start;
+        if(result == DHT_SUCCESS) {
+            if(memcmp(data, sent, 5) == 0) { legacy.good++; } else { legacy.wrong++; }
+        }
+        dht_trace_record(DHT11, 0, 0, tpus != 0 ? DHT_CAPTURE_TIME : DHT_CAPTURE_COUNT, result, widths, count);
+
+        dht_frame_t frame;
+        start = bench_now_ns();
+        result = dht_decode_frame(widths, count, tpus, &frame);
+        robust.ns += bench_now_ns() - start;
+        if(result == DHT_SUCCESS) {
+            if(memcmp(frame.data, sent, 5) == 0) { robust.good++; } else { robust.wrong++; }
+        }
+        confidence += frame.confidence;
+    }
+
+    fprintf(stdout, "Frames      : %d (jitter %.1fus, glitch %.4f/bit, stretch %.3f, stray %.3f, %s)\n",
+        cfg.frames, cfg.jitter_us, cfg.glitch_rate, cfg.stretch_rate, cfg.junk_rate,
+        cfg.loops_per_us > 0.0f ? "loop counts" : "microseconds");
+    fprintf(stdout, "Fixed       : %6.2f%% good, %d wrong, %7.1f ns/frame\n",
+        100.0 * legacy.good / cfg.frames, legacy.wrong, legacy.ns / cfg.frames);
+    fprintf(stdout, "Robust      : %6.2f%% good, %d wrong, %7.1f ns/frame, confidence %.3f\n",
+        100.0 * robust.good / cfg.frames, robust.wrong, robust.ns / cfg.frames, confidence / cfg.frames);
+
+    dht_trace_close();
+    return EXIT_SUCCESS;
+}
+//============================================================================//
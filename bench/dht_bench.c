@@ -0,0 +1,264 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_bench.c
+ * @version v1.2.0 -- CHANGELOG
+ *                  | v1.0.0 - Added DHT read benchmark on simulated sensors
+ *                  | v1.1.0 - Event capture mode on the character device stand-in
+ *                  | v1.2.0 - Sample capture mode
+ *
+ * @note    Runs dht_read() against the simulated sensor and reports decode
+ *          success rate, latency per read and CPU time per read
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#define _GNU_SOURCE
+#include <getopt.h>
+#include <math.h>
+#include <poll.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "dht11.h"
+#include "dht_async.h"
+#include "dht_bank.h"
+#include "dht_sim.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+#define BENCH_ERRORS    5
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static double bench_now_ms(clockid_t clock) {
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static int bench_cmp(const void *a, const void *b) {
+    double x = *(const double *) a;
+    double y = *(const double *) b;
+    return (x > y) - (x < y);
+}
+
+static double bench_percentile(const double *sorted, int n, double p) {
+    int index = (int) (p * (n - 1) + 0.5);
+    return sorted[index];
+}
+
+static void bench_usage(const char *name) {
+    fprintf(stderr,
+        "Usage: %s [options]\n"
+        "  -n <reads>    Number of reads (default 20)\n"
+        "  -t <type>     Sensor type 11 or 22 (default 11)\n"
+        "  -j <us>       Pulse jitter in microseconds (default 0)\n"
+        "  -g <rate>     Glitch probability per bit (default 0)\n"
+        "  -c <rate>     Bad checksum probability per frame (default 0)\n"
+        "  -r <rate>     Missed start signal probability (default 0)\n"
+        "  -s <seed>     Random seed (default 1)\n"
+        "  -m <mode>     Capture mode count, time, event or sample (default time)\n"
+        "  -k <sensors>  Sensors on the bank, more than one uses dht_read_bank\n"
+        "  -a            Read through dht_start/dht_poll instead of dht_read\n",
+        name);
+}
+
+int main(int argc, char **argv) {
+    int reads = 20;
+    int sensors = 1;
+    int async = 0;
+    dht_sim_cfg_t cfg = {
+        .type = DHT11,
+        .base = 0,
+        .num = 20,
+        .humidity = 45.0f,
+        .temperature = 23.0f,
+        .seed = 1
+    };
+
+    dht_capture_e mode = DHT_CAPTURE_TIME;
+    int opt;
+    while((opt = getopt(argc, argv, "n:t:j:g:c:r:s:m:k:ah")) != -1) {
+        switch(opt) {
+        case 'n': reads = atoi(optarg); break;
+        case 't': cfg.type = atoi(optarg); break;
+        case 'j': cfg.jitter_us = atoi(optarg); break;
+        case 'g': cfg.glitch_rate = atof(optarg); break;
+        case 'c': cfg.bad_csum_rate = atof(optarg); break;
+        case 'r': cfg.no_response_rate = atof(optarg); break;
+        case 's': cfg.seed = strtoul(optarg, NULL, 0); break;
+        case 'a': async = 1; break;
+        case 'k': sensors = atoi(optarg); break;
+        case 'm':
+            mode = !strcmp(optarg, "count") ? DHT_CAPTURE_COUNT :
+                !strcmp(optarg, "event") ? DHT_CAPTURE_EVENT :
+                !strcmp(optarg, "sample") ? DHT_CAPTURE_SAMPLE : DHT_CAPTURE_TIME;
+            break;
+        default: bench_usage(argv[0]); return EXIT_FAILURE;
+        }
+    }
+    if(reads < 1 || sensors < 1 || sensors > 32 - cfg.num ||
+       (cfg.type != DHT11 && cfg.type != DHT22) ||
+       (mode == DHT_CAPTURE_EVENT && (sensors > 1 || async))) {
+        bench_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    if(cfg.type == DHT22) { cfg.temperature = -12.5f; cfg.humidity = 61.3f; }
+
+    // Keep the reader and the waveform generator on separate CPUs, the
+    // character device stand-in has no generator thread
+    int cpus = (int) sysconf(_SC_NPROCESSORS_ONLN);
+    int sim_cpu = -1;
+    if(mode == DHT_CAPTURE_EVENT) {
+        // Nothing to place
+    } else if(cpus >= 2) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(0, &set);
+        sched_setaffinity(0, sizeof(set), &set);
+        sim_cpu = 1;
+    } else {
+        fprintf(stderr, "warning: single CPU, simulated timing will be unreliable\n");
+    }
+
+    // Extra sensors sit on the following pins of the same bank
+    dht_sim_cfg_t cfgs[DHT_SIM_MAX_DEVICES];
+    uint32_t mask = 0;
+    for(int i = 0; i < sensors; i++) {
+        cfgs[i] = cfg;
+        cfgs[i].num = cfg.num + i;
+        cfgs[i].seed = cfg.seed + i;
+        mask |= 1u << cfgs[i].num;
+    }
+
+    int started = mode == DHT_CAPTURE_EVENT ?
+        dht_sim_start_line(cfgs, sensors) : dht_sim_start(cfgs, sensors, sim_cpu);
+    if(started != DHT_SUCCESS) {
+        fprintf(stderr, "Failed to start the sensor simulation\n");
+        return EXIT_FAILURE;
+    }
+
+    double *latency = calloc(reads, sizeof(double));
+    double *cpu = calloc(reads, sizeof(double));
+    if(latency == NULL || cpu == NULL) {
+        dht_sim_stop();
+        return EXIT_FAILURE;
+    }
+
+    dht_set_capture(mode);
+
+    dht_async_t dev;
+    if(async && dht_async_init(&dev, cfg.type, cfg.base, cfg.num) != DHT_SUCCESS) {
+        fprintf(stderr, "Failed to initialize the non-blocking reader\n");
+        dht_sim_stop();
+        return EXIT_FAILURE;
+    }
+
+    int errors[BENCH_ERRORS] = { 0 };
+    int mismatches = 0;
+    for(int i = 0; i < reads; i++) {
+        dht_reading_t readings[32];
+        memset(readings, 0, sizeof(readings));
+
+        double wall = bench_now_ms(CLOCK_MONOTONIC);
+        double used = bench_now_ms(CLOCK_THREAD_CPUTIME_ID);
+        if(sensors == 1 && async) {
+            // Sleep on the timerfd between the steps of the read
+            int result = dht_start(&dev);
+            while(result == DHT_SUCCESS || result == DHT_PENDING) {
+                struct pollfd pfd = { .fd = dht_fd(&dev), .events = POLLIN };
+                poll(&pfd, 1, -1);
+                result = dht_poll(&dev, &readings[0].humidity, &readings[0].temperature);
+                if(result != DHT_PENDING) { break; }
+            }
+            readings[0].status = result;
+        } else if(sensors == 1) {
+            readings[0].status = dht_read(cfg.type, cfg.base, cfg.num,
+                &readings[0].humidity, &readings[0].temperature);
+        } else {
+            int result = dht_read_bank(cfg.type, cfg.base, mask, readings, 32);
+            for(int k = 0; result < 0 && k < sensors; k++) {
+                readings[k].status = result;
+            }
+        }
+        cpu[i] = bench_now_ms(CLOCK_THREAD_CPUTIME_ID) - used;
+        latency[i] = bench_now_ms(CLOCK_MONOTONIC) - wall;
+
+        for(int k = 0; k < sensors; k++) {
+            int result = readings[k].status;
+            if(result > 0 || result < -(BENCH_ERRORS - 1)) { result = DHT_ERR_ARGUMENT; }
+            errors[-result]++;
+            if(result == DHT_SUCCESS &&
+               (fabsf(readings[k].humidity - cfg.humidity) > 0.05f ||
+                fabsf(readings[k].temperature - cfg.temperature) > 0.05f)) {
+                mismatches++;
+            }
+        }
+    }
+
+    if(async) { dht_async_close(&dev); }
+
+    dht_sim_stats_t stats;
+    memset(&stats, 0, sizeof(stats));
+    for(int k = 0; k < sensors; k++) {
+        dht_sim_stats_t one;
+        dht_sim_stats(k, &one);
+        stats.starts += one.starts;
+        stats.frames += one.frames;
+        stats.glitches += one.glitches;
+        stats.bad_csums += one.bad_csums;
+        stats.ignored += one.ignored;
+    }
+    dht_sim_stop();
+
+    double latency_sum = 0.0;
+    double cpu_sum = 0.0;
+    for(int i = 0; i < reads; i++) {
+        latency_sum += latency[i];
+        cpu_sum += cpu[i];
+    }
+    qsort(latency, reads, sizeof(double), bench_cmp);
+    qsort(cpu, reads, sizeof(double), bench_cmp);
+
+    int total = reads * sensors;
+    fprintf(stdout, "DHT%d %s capture reads: %d x %d sensors (jitter %uus, glitch %.3f, bad csum %.3f, missed %.3f)\n",
+        cfg.type, sensors > 1 ? "bank" : async ? "async" :
+        mode == DHT_CAPTURE_COUNT ? "count" : mode == DHT_CAPTURE_EVENT ? "event" :
+        mode == DHT_CAPTURE_SAMPLE ? "sample" : "time", reads, sensors,
+        cfg.jitter_us, cfg.glitch_rate, cfg.bad_csum_rate, cfg.no_response_rate);
+    fprintf(stdout, "  success     %6.2f %% (%d)\n", 100.0 * errors[0] / total, errors[0]);
+    if(errors[0] > 0) {
+        fprintf(stdout, "  failed/good %6.3f\n", (double) (total - errors[0]) / errors[0]);
+    }
+    fprintf(stdout, "  wrong value %6.2f %% (%d)\n", 100.0 * mismatches / total, mismatches);
+    fprintf(stdout, "  timeout     %6d\n", errors[-DHT_ERR_TIMEOUT]);
+    fprintf(stdout, "  checksum    %6d\n", errors[-DHT_ERR_CHECKSUM]);
+    fprintf(stdout, "  gpio        %6d\n", errors[-DHT_ERR_GPIO]);
+    fprintf(stdout, "  latency ms  mean %8.3f  p50 %8.3f  p99 %8.3f  max %8.3f\n",
+        latency_sum / reads, bench_percentile(latency, reads, 0.5),
+        bench_percentile(latency, reads, 0.99), latency[reads - 1]);
+    fprintf(stdout, "  cpu ms      mean %8.3f  p50 %8.3f  p99 %8.3f  max %8.3f\n",
+        cpu_sum / reads, bench_percentile(cpu, reads, 0.5),
+        bench_percentile(cpu, reads, 0.99), cpu[reads - 1]);
+    fprintf(stdout, "  simulator   starts %u frames %u glitches %u bad csums %u ignored %u\n",
+        stats.starts, stats.frames, stats.glitches, stats.bad_csums, stats.ignored);
+
+    free(latency);
+    free(cpu);
+    return EXIT_SUCCESS;
+}
+//============================================================================//
@@ -0,0 +1,153 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_replay.c
+ * @version v1.2.0 -- CHANGELOG
+ *                  | v1.0.0 - Added offline replay of capture traces
+ *                  | v1.1.0 - Edge event captures decoded in microseconds
+ *                  | v1.2.0 - Widths decoded in the unit of their record
+ *
+ * @note    Streams the frames of a capture trace (see dht_trace.h) through
+ *          the decoder and reports throughput and a breakdown of the results,
+ *          including frames whose outcome differs from the live read.
+ *
+ *          Usage: dht_replay [-r passes] [-v] trace
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "dht_decoder.h"
+#include "dht_trace.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+#define REPLAY_RESULTS  5
+#define REPLAY_LEVELS   4
+
+typedef struct REPLAY_STATS {
+    uint64_t frames;
+    uint64_t results[REPLAY_RESULTS];       // Indexed by -dht_err_e
+    uint64_t fixed;                         // Failed live, decoded now
+    uint64_t broken;                        // Decoded live, fails now
+    uint64_t glitched;                      // Frames with merged glitches
+    uint64_t resynced;                      // Preamble not at the first width
+    uint64_t confidence[REPLAY_LEVELS];     // Quartiles of good frames
+} replay_stats_t;
+
+static const char *REPLAY_NAMES[REPLAY_RESULTS] = {
+    "success", "gpio", "argument", "checksum", "timeout"
+};
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static double replay_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int replay_frame(const dht_trace_record_t *record, replay_stats_t *stats, int verbose, size_t index) {
+    uint32_t widths[DHT_RUNS_MAX];
+    for(int i = 0; i < record->count; i++) {
+        widths[i] = record->widths[i];
+    }
+
+    // Decoded in the unit the live read used, calibrated loops per
+    // microsecond for counts
+    dht_frame_t frame;
+    int result = dht_decode_frame(widths, record->count, record->unit, &frame);
+    if(result == DHT_SUCCESS) {
+        float humidity;
+        float temperature;
+        result = dht_convert(record->type, frame.data, &humidity, &temperature);
+    }
+
+    stats->frames++;
+    stats->results[result <= 0 && result > -REPLAY_RESULTS ? -result : DHT_SUCCESS]++;
+    if(result == DHT_SUCCESS && record->status != DHT_SUCCESS) { stats->fixed++; }
+    if(result != DHT_SUCCESS && record->status == DHT_SUCCESS) { stats->broken++; }
+    if(frame.glitches != 0) { stats->glitched++; }
+    if(frame.offset != 0) { stats->resynced++; }
+    if(result == DHT_SUCCESS) {
+        int level = (int) (frame.confidence * REPLAY_LEVELS);
+        stats->confidence[level >= REPLAY_LEVELS ? REPLAY_LEVELS - 1 : level]++;
+    }
+
+    if(verbose && result != record->status) {
+        fprintf(stdout, "#%zu gpio%u_%u: live %d, replay %d, %u widths, confidence %.2f\n",
+            index, record->base, record->num, record->status, result, record->count, frame.confidence);
+    }
+    return result;
+}
+
+int main(int argc, char **argv) {
+    int passes = 1;
+    int verbose = 0;
+    int opt;
+    while((opt = getopt(argc, argv, "r:vh")) != -1) {
+        switch(opt) {
+        case 'r': passes = atoi(optarg); break;
+        case 'v': verbose = 1; break;
+        default:
+            fprintf(stderr, "Usage: %s [-r passes] [-v] trace\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if(optind >= argc || passes <= 0) {
+        fprintf(stderr, "Usage: %s [-r passes] [-v] trace\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    dht_trace_t trace;
+    if(dht_trace_map(argv[optind], &trace) != DHT_SUCCESS) {
+        fprintf(stderr, "Failed to map trace %s\n", argv[optind]);
+        return EXIT_FAILURE;
+    }
+
+    replay_stats_t stats;
+    memset(&stats, 0, sizeof(stats));
+    double start = replay_now();
+    for(int pass = 0; pass < passes; pass++) {
+        for(size_t i = 0; i < trace.count; i++) {
+            replay_frame(&trace.records[i], &stats, verbose && pass == 0, i);
+        }
+    }
+    double elapsed = replay_now() - start;
+
+    fprintf(stdout, "Trace       : %s, %zu frames, created at %u loops/ms\n",
+        argv[optind], trace.count, trace.header->loops_per_ms);
+    fprintf(stdout, "Replayed    : %llu frames in %.3f s, %.0f frames/s, %.1f MB/s\n",
+        (unsigned long long) stats.frames, elapsed, stats.frames / elapsed,
+        stats.frames * sizeof(dht_trace_record_t) / elapsed / 1e6);
+    for(int r = 0; r < REPLAY_RESULTS; r++) {
+        if(stats.results[r] == 0) { continue; }
+        fprintf(stdout, "  %-10s: %llu (%.2f%%)\n", REPLAY_NAMES[r],
+            (unsigned long long) stats.results[r], 100.0 * stats.results[r] / stats.frames);
+    }
+    fprintf(stdout, "Against live: %llu fixed, %llu broken\n",
+        (unsigned long long) stats.fixed, (unsigned long long) stats.broken);
+    fprintf(stdout, "Recovered   : %llu with glitches, %llu resynchronized\n",
+        (unsigned long long) stats.glitched, (unsigned long long) stats.resynced);
+    fprintf(stdout, "Confidence  : <0.25 %llu, <0.5 %llu, <0.75 %llu, >=0.75 %llu\n",
+        (unsigned long long) stats.confidence[0], (unsigned long long) stats.confidence[1],
+        (unsigned long long) stats.confidence[2], (unsigned long long) stats.confidence[3]);
+
+    dht_trace_unmap(&trace);
+    return EXIT_SUCCESS;
+}
+//============================================================================//
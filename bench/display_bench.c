@@ -0,0 +1,253 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    display_bench.c
+ * @version v1.1.0 -- CHANGELOG
+ *                  | v1.0.0 - Added incremental display update benchmark
+ *                  | v1.1.0 - Added fonts mapped from an asset pack
+ *
+ * @note    Plays simulated seconds of the mirror screen (clock every second,
+ *          readings every two seconds, sparkline every minute) on a memory
+ *          display, once with dirty rectangles and once redrawing the whole
+ *          screen, and reports the time and pixels copied per frame. With -a the
+ *          fonts are the mapped atlases of an asset pack instead of being
+ *          rasterized, the time to set them up shows the difference.
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <getopt.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "display.h"
+#include "display_pack.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+#define BENCH_POINTS    120
+
+static const uint32_t BENCH_BG      = 0x000000;
+static const uint32_t BENCH_FG      = 0xFFFFFF;
+static const uint32_t BENCH_DIM     = 0x8090A0;
+
+typedef struct BENCH_SCREEN {
+    display_t disp;
+    display_font_t big;
+    display_font_t small;
+    int clock;
+    int temperature;
+    int humidity;
+    int spark;
+    double font_us;             // Rasterizing or mapping the fonts
+} bench_screen_t;
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static double bench_now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static int bench_font(display_font_t *font, const display_t *disp, const display_pack_t *pack, const char *name,
+    uint32_t scale) {
+    if(pack != NULL) { return display_pack_font(pack, disp, name, font); }
+    return display_font_init(font, disp, scale, BENCH_FG, BENCH_BG);
+}
+
+static int bench_setup(bench_screen_t *screen, uint32_t width, uint32_t height, uint32_t bpp,
+    const display_pack_t *pack) {
+    display_t *disp = &screen->disp;
+    if(display_open_memory(disp, width, height, bpp) != DISPLAY_SUCCESS) { return -1; }
+
+    // Clock across most of the width, readings at half its size
+    uint32_t big = width / (8 * 6 + 8);
+    uint32_t small = big / 2 ? big / 2 : 1;
+    double start = bench_now_us();
+    if(bench_font(&screen->big, disp, pack, "big", big) != DISPLAY_SUCCESS ||
+       bench_font(&screen->small, disp, pack, "small", small) != DISPLAY_SUCCESS) {
+        return -1;
+    }
+    screen->font_us = bench_now_us() - start;
+
+    int margin = (int) width / 20;
+    int y = margin;
+    screen->clock = display_text(disp, ((int) width - 8 * (int) screen->big.width) / 2, y, 8, &screen->big);
+    y += (int) screen->big.height + margin;
+    screen->temperature = display_text(disp, margin, y, 7, &screen->small);
+    screen->humidity = display_text(disp, (int) width - margin - 6 * (int) screen->small.width, y, 6, &screen->small);
+    y += (int) screen->small.height + margin;
+
+    display_rect_t area = { margin, y, (int) width - 2 * margin, (int) height - y - margin };
+    screen->spark = display_spark(disp, area, BENCH_DIM, BENCH_BG);
+    if(screen->clock < 0 || screen->temperature < 0 || screen->humidity < 0 || screen->spark < 0) { return -1; }
+
+    display_clear(disp, BENCH_BG);
+    display_update(disp);
+    return 0;
+}
+
+static void bench_close(bench_screen_t *screen) {
+    display_font_free(&screen->big);
+    display_font_free(&screen->small);
+    display_close(&screen->disp);
+}
+
+static void bench_ppm(const display_t *disp, const char *path) {
+    FILE *file = fopen(path, "wb");
+    if(file == NULL) { return; }
+
+    fprintf(file, "P6\n%u %u\n255\n", disp->width, disp->height);
+    for(uint32_t y = 0; y < disp->height; y++) {
+        for(uint32_t x = 0; x < disp->width; x++) {
+            const uint8_t *p = disp->front + (size_t) y * disp->stride + (size_t) x * disp->bytes;
+            uint8_t rgb[3];
+            if(disp->bytes == 2) {
+                uint16_t px = *(const uint16_t *) p;
+                rgb[0] = (uint8_t) ((px >> 11) << 3);
+                rgb[1] = (uint8_t) (((px >> 5) & 0x3F) << 2);
+                rgb[2] = (uint8_t) ((px & 0x1F) << 3);
+            } else {
+                uint32_t px = *(const uint32_t *) p;
+                rgb[0] = (uint8_t) (px >> disp->shift[0]);
+                rgb[1] = (uint8_t) (px >> disp->shift[1]);
+                rgb[2] = (uint8_t) (px >> disp->shift[2]);
+            }
+            fwrite(rgb, 1, 3, file);
+        }
+    }
+    fclose(file);
+}
+
+static void bench_run(bench_screen_t *screen, int seconds, int full, double *mean_us, double *max_us,
+    double *pixels) {
+    display_t *disp = &screen->disp;
+    float points[BENCH_POINTS];
+    for(int i = 0; i < BENCH_POINTS; i++) { points[i] = NAN; }
+
+    float temperature = 22.0f;
+    float humidity = 45.0f;
+    uint64_t flushed = disp->flushed;
+    double total = 0.0;
+    *max_us = 0.0;
+    srand(1);
+
+    for(int s = 0; s < seconds; s++) {
+        double start = bench_now_us();
+
+        // Time of day starting at 09:59:30, crossing the hour
+        int t = 9 * 3600 + 59 * 60 + 30 + s;
+        char text[DISPLAY_TEXT_MAX + 1];
+        snprintf(text, sizeof(text), "%02d:%02d:%02d", (t / 3600) % 24, (t / 60) % 60, t % 60);
+        display_set_text(disp, screen->clock, text);
+
+        if(s % 2 == 0) {
+            temperature += ((rand() % 3) - 1) * 0.1f;
+            humidity += ((rand() % 3) - 1) * 0.1f;
+            snprintf(text, sizeof(text), "%.1f\xb0" "C", temperature);
+            display_set_text(disp, screen->temperature, text);
+            snprintf(text, sizeof(text), "%.1f%%", humidity);
+            display_set_text(disp, screen->humidity, text);
+        }
+
+        if(s % 60 == 0) {
+            memmove(points, points + 1, (BENCH_POINTS - 1) * sizeof(float));
+            points[BENCH_POINTS - 1] = temperature;
+            display_set_spark(disp, screen->spark, points, BENCH_POINTS, 15.0f, 30.0f);
+        }
+
+        if(full) { display_clear(disp, BENCH_BG); }
+        display_update(disp);
+
+        double used = bench_now_us() - start;
+        total += used;
+        if(used > *max_us) { *max_us = used; }
+    }
+
+    *mean_us = total / seconds;
+    *pixels = (double) (disp->flushed - flushed) / seconds;
+}
+
+int main(int argc, char **argv) {
+    uint32_t width = 800;
+    uint32_t height = 480;
+    uint32_t bpp = 16;
+    int seconds = 3600;
+    const char *ppm = NULL;
+    const char *assets = NULL;
+
+    int opt;
+    while((opt = getopt(argc, argv, "W:H:b:n:o:a:h")) != -1) {
+        switch(opt) {
+        case 'W': width = (uint32_t) atoi(optarg); break;
+        case 'H': height = (uint32_t) atoi(optarg); break;
+        case 'b': bpp = (uint32_t) atoi(optarg); break;
+        case 'n': seconds = atoi(optarg); break;
+        case 'o': ppm = optarg; break;
+        case 'a': assets = optarg; break;
+        default:
+            fprintf(stderr,
+                "Usage: %s [options]\n"
+                "  -W <pixels>   Display width (default 800)\n"
+                "  -H <pixels>   Display height (default 480)\n"
+                "  -b <bpp>      16 or 32 bits per pixel (default 16)\n"
+                "  -n <seconds>  Simulated seconds (default 3600)\n"
+                "  -o <ppm>      Write the last frame as a PPM image\n"
+                "  -a <pack>     Map the big and small fonts from an asset pack\n",
+                argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if(seconds <= 0) { return EXIT_FAILURE; }
+
+    display_pack_t pack;
+    if(assets != NULL && display_pack_open(&pack, assets) != DISPLAY_SUCCESS) {
+        fprintf(stderr, "Failed to open %s\n", assets);
+        return EXIT_FAILURE;
+    }
+
+    fprintf(stdout, "Display %ux%u %u bpp, %d seconds\n", width, height, bpp, seconds);
+    const char *names[2] = { "dirty rects", "full redraw" };
+    static bench_screen_t screens[2];
+    for(int full = 0; full < 2; full++) {
+        bench_screen_t *screen = &screens[full];
+        if(bench_setup(screen, width, height, bpp, assets != NULL ? &pack : NULL) != 0) {
+            fprintf(stderr, "Failed to set up the display\n");
+            bench_close(&screens[0]);
+            bench_close(&screens[1]);
+            if(assets != NULL) { display_pack_close(&pack); }
+            return EXIT_FAILURE;
+        }
+
+        double mean_us;
+        double max_us;
+        double pixels;
+        bench_run(screen, seconds, full, &mean_us, &max_us, &pixels);
+        fprintf(stdout, "  %-12s %9.1f us/frame (max %9.1f)  %10.0f pixels/frame  fonts %7.1f us\n",
+            names[full], mean_us, max_us, pixels, screen->font_us);
+    }
+
+    // Dirty tracking must end on the very same screen as redrawing it all
+    int same = memcmp(screens[0].disp.front, screens[1].disp.front, screens[0].disp.front_size) == 0;
+    fprintf(stdout, "  last frames %s\n", same ? "identical" : "DIFFER");
+    if(ppm != NULL) { bench_ppm(&screens[0].disp, ppm); }
+
+    bench_close(&screens[0]);
+    bench_close(&screens[1]);
+    if(assets != NULL) { display_pack_close(&pack); }
+    return same ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+//============================================================================//
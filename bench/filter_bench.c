@@ -0,0 +1,130 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    filter_bench.c
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added reading filter benchmark
+ *
+ * @note    Feeds a slowly drifting temperature, quantized like a DHT11 and
+ *          with noise and checksum-valid spikes added, through each filter
+ *          stage alone and through the default chain. Reports the error to
+ *          the true temperature, the spikes that got through and the time
+ *          per reading.
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <getopt.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "dht_filter.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+#define BENCH_STAGES    5
+
+// Errors beyond this are counted as spikes shown to the user
+static const float BENCH_SPIKE = 3.0f;
+static const uint64_t BENCH_PERIOD_NS = 2000000000ULL;
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static double bench_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static float bench_gauss(void) {
+    // Box-Muller, one of the pair is enough here
+    double u1 = (rand() + 1.0) / (RAND_MAX + 2.0);
+    double u2 = (rand() + 1.0) / (RAND_MAX + 2.0);
+    return (float) (sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2));
+}
+
+int main(int argc, char **argv) {
+    int count = 100000;
+    float noise = 0.3f;
+    float spikes = 0.01f;
+    float step = 1.0f;
+
+    int opt;
+    while((opt = getopt(argc, argv, "n:s:p:q:h")) != -1) {
+        switch(opt) {
+        case 'n': count = atoi(optarg); break;
+        case 's': noise = (float) atof(optarg); break;
+        case 'p': spikes = (float) atof(optarg); break;
+        case 'q': step = (float) atof(optarg); break;
+        default:
+            fprintf(stderr,
+                "Usage: %s [options]\n"
+                "  -n <count>    Readings, one every 2 s (default 100000)\n"
+                "  -s <sigma>    Noise in degrees before quantizing (default 0.3)\n"
+                "  -p <prob>     Share of readings that are spikes (default 0.01)\n"
+                "  -q <step>     Resolution, 1 for DHT11, 0.1 for DHT22 (default 1)\n",
+                argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if(count <= 0 || step <= 0.0f) { return EXIT_FAILURE; }
+
+    const char *names[BENCH_STAGES] = { "raw", "median", "ema", "hampel", "chain" };
+    dht_filter_cfg_t cfgs[BENCH_STAGES];
+    const dht_filter_cfg_t off = { .window = 0, .median = 0, .hampel_k = 0.0f, .alpha = 1.0f, .max_rate = 0.0f };
+    for(int i = 0; i < BENCH_STAGES; i++) { cfgs[i] = off; }
+    cfgs[1].window = DHT_FILTER_TEMPERATURE.window;
+    cfgs[1].median = 1;
+    cfgs[2].alpha = DHT_FILTER_TEMPERATURE.alpha;
+    cfgs[3].window = DHT_FILTER_TEMPERATURE.window;
+    cfgs[3].hampel_k = DHT_FILTER_TEMPERATURE.hampel_k;
+    cfgs[3].min_dev = DHT_FILTER_TEMPERATURE.min_dev;
+    cfgs[4] = DHT_FILTER_TEMPERATURE;
+
+    fprintf(stdout, "%d readings, noise %.2f, spikes %.3f, resolution %.1f\n", count, noise, spikes, step);
+    for(int i = 0; i < BENCH_STAGES; i++) {
+        dht_filter_t filter;
+        if(dht_filter_init(&filter, &cfgs[i]) != DHT_SUCCESS) { return EXIT_FAILURE; }
+
+        double sq = 0.0;
+        float worst = 0.0f;
+        int shown = 0;
+        double used = 0.0;
+        srand(1);
+        for(int n = 0; n < count; n++) {
+            // A few degrees over the day, the spikes are what a damaged but
+            // checksum-valid frame reads
+            uint64_t time_ns = (uint64_t) (n + 1) * BENCH_PERIOD_NS;
+            float truth = 22.0f + 3.0f * (float) sin(2.0 * M_PI * (double) n / 43200.0);
+            float value = roundf((truth + noise * bench_gauss()) / step) * step;
+            if((float) rand() / RAND_MAX < spikes) {
+                value += (rand() % 2 ? 1.0f : -1.0f) * (float) (5 + rand() % 26);
+            }
+
+            double start = bench_now_ns();
+            float out = dht_filter_update(&filter, value, time_ns);
+            used += bench_now_ns() - start;
+
+            float error = fabsf(out - truth);
+            sq += (double) error * error;
+            if(error > worst) { worst = error; }
+            if(error > BENCH_SPIKE) { shown++; }
+        }
+
+        fprintf(stdout, "  %-7s rms %6.3f  max %6.2f  spikes shown %6d  outliers %6u  %6.1f ns/reading\n",
+            names[i], sqrt(sq / count), worst, shown, filter.outliers, used / count);
+    }
+    return EXIT_SUCCESS;
+}
+//============================================================================//
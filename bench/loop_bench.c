@@ -0,0 +1,149 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    loop_bench.c
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added timer wheel benchmark
+ *
+ * @note    Measures the cost of starting and stopping timers spread over an
+ *          hour, then runs periodic timers of random cadences for a while,
+ *          without and with slack, and reports the wakeups of the loop, the
+ *          lateness of the expiries and the CPU time used.
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "loop.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+typedef struct BENCH_STATS {
+    uint64_t fired;
+    uint64_t late_sum;
+    uint64_t late_max;
+} bench_stats_t;
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static double bench_clock_ns(clockid_t clock) {
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void bench_expired(loop_t *loop, loop_timer_t *timer) {
+    // Deadline that just passed, the timer is already rescheduled
+    bench_stats_t *stats = timer->arg;
+    uint64_t late = loop_now(loop) - (timer->due - timer->period_ms);
+    stats->fired++;
+    stats->late_sum += late;
+    if(late > stats->late_max) { stats->late_max = late; }
+}
+
+static void bench_done(loop_t *loop, loop_timer_t *timer) {
+    loop_stop(loop);
+}
+
+static int bench_ops(loop_timer_t *timers, int count) {
+    loop_t loop;
+    if(loop_init(&loop) != LOOP_SUCCESS) { return -1; }
+
+    bench_stats_t stats = { 0 };
+    srand(1);
+    for(int i = 0; i < count; i++) { loop_timer_init(&timers[i], bench_expired, &stats); }
+
+    double start = bench_clock_ns(CLOCK_MONOTONIC);
+    for(int i = 0; i < count; i++) { loop_timer_start(&loop, &timers[i], (uint32_t) (rand() % 3600000), 0, 0); }
+    double insert = bench_clock_ns(CLOCK_MONOTONIC);
+    for(int i = 0; i < count; i++) { loop_timer_start(&loop, &timers[i], (uint32_t) (rand() % 3600000), 0, 0); }
+    double restart = bench_clock_ns(CLOCK_MONOTONIC);
+    for(int i = 0; i < count; i++) { loop_timer_stop(&loop, &timers[i]); }
+    double end = bench_clock_ns(CLOCK_MONOTONIC);
+
+    fprintf(stdout, "  start %6.1f ns  restart %6.1f ns  stop %6.1f ns per timer (%u left)\n",
+        (insert - start) / count, (restart - insert) / count, (end - restart) / count, loop.timers);
+    loop_close(&loop);
+    return 0;
+}
+
+static int bench_run(loop_timer_t *timers, int count, int seconds, uint32_t slack_pct) {
+    loop_t loop;
+    if(loop_init(&loop) != LOOP_SUCCESS) { return -1; }
+
+    // Cadences of 100 ms to 10 s with random phases, as the jobs of a screen
+    bench_stats_t stats = { 0 };
+    srand(2);
+    for(int i = 0; i < count; i++) {
+        uint32_t period = 100 + (uint32_t) (rand() % 9901);
+        loop_timer_init(&timers[i], bench_expired, &stats);
+        loop_timer_start(&loop, &timers[i], (uint32_t) rand() % period, period, period * slack_pct / 100);
+    }
+    loop_timer_t done;
+    loop_timer_init(&done, bench_done, NULL);
+    loop_timer_start(&loop, &done, (uint32_t) seconds * 1000, 0, 0);
+
+    double cpu = bench_clock_ns(CLOCK_PROCESS_CPUTIME_ID);
+    int result = loop_run(&loop);
+    cpu = bench_clock_ns(CLOCK_PROCESS_CPUTIME_ID) - cpu;
+
+    if(result == LOOP_SUCCESS) {
+        fprintf(stdout, "  slack %2u%%  %8llu expiries  %6.1f wakeups/s  %6.1f expiries/wakeup"
+            "  late %5.2f ms (max %3llu)  cpu %5.2f%%\n",
+            slack_pct, (unsigned long long) stats.fired, (double) loop.wakeups / seconds,
+            loop.wakeups ? (double) stats.fired / loop.wakeups : 0.0,
+            stats.fired ? (double) stats.late_sum / stats.fired : 0.0, (unsigned long long) stats.late_max,
+            cpu / (seconds * 1e7));
+    }
+    loop_close(&loop);
+    return result;
+}
+
+int main(int argc, char **argv) {
+    int count = 10000;
+    int seconds = 5;
+    uint32_t slack_pct = 5;
+
+    int opt;
+    while((opt = getopt(argc, argv, "n:d:s:h")) != -1) {
+        switch(opt) {
+        case 'n': count = atoi(optarg); break;
+        case 'd': seconds = atoi(optarg); break;
+        case 's': slack_pct = (uint32_t) atoi(optarg); break;
+        default:
+            fprintf(stderr,
+                "Usage: %s [options]\n"
+                "  -n <timers>   Number of timers (default 10000)\n"
+                "  -d <seconds>  Duration of each run (default 5)\n"
+                "  -s <percent>  Slack as a share of the period (default 5)\n",
+                argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if(count <= 0 || seconds <= 0) { return EXIT_FAILURE; }
+
+    loop_timer_t *timers = calloc((size_t) count, sizeof(loop_timer_t));
+    if(timers == NULL) { return EXIT_FAILURE; }
+
+    fprintf(stdout, "%d timers\n", count);
+    int result = bench_ops(timers, count);
+    if(result == 0) { result = bench_run(timers, count, seconds, 0); }
+    if(result == 0 && slack_pct != 0) { result = bench_run(timers, count, seconds, slack_pct); }
+
+    free(timers);
+    return result == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+//============================================================================//
@@ -0,0 +1,111 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    mmio_bench.cpp
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added gpio access benchmark
+ *
+ * @note    Compares the runtime gpio_t inlines of mmio.h with the compile time
+ *          templates of mmio.hpp on the simulated register file: driving four
+ *          pins up and down, and polling one input.
+ *
+ *          Usage: mmio_bench [-n iterations]
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <unistd.h>
+
+#include "mmio.hpp"
+#include "mmio_sim.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+static const int BENCH_BASE = 1;
+
+using Led0 = mmio::Pin<BENCH_BASE, 12>;
+using Led1 = mmio::Pin<BENCH_BASE, 13>;
+using Led2 = mmio::Pin<BENCH_BASE, 14>;
+using Led3 = mmio::Pin<BENCH_BASE, 15>;
+using Leds = mmio::Pins<Led0, Led1, Led2, Led3>;
+using Data = mmio::Pin<BENCH_BASE, 20>;
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static double bench_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<double>(ts.tv_sec) + static_cast<double>(ts.tv_nsec) / 1e9;
+}
+
+static void bench_report(const char *name, double seconds, long iterations) {
+    fprintf(stdout, "%-28s %8.2f ns/iteration\n", name, seconds * 1e9 / static_cast<double>(iterations));
+}
+
+int main(int argc, char **argv) {
+    long iterations = 10000000;
+    int opt;
+    while((opt = getopt(argc, argv, "n:")) != -1) {
+        if(opt == 'n') {
+            iterations = atol(optarg);
+        } else {
+            fprintf(stderr, "Usage: %s [-n iterations]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if(iterations <= 0) { return EXIT_FAILURE; }
+
+    mmio_set_backend(&MMIO_BACKEND_SIM);
+
+    gpio_t leds[4];
+    gpio_t data;
+    for(int i = 0; i < 4; i++) {
+        if(mmio_get_gpio(BENCH_BASE, 12 + i, &leds[i]) != MMIO_SUCCESS) { return EXIT_FAILURE; }
+    }
+    if(mmio_get_gpio(BENCH_BASE, Data::num, &data) != MMIO_SUCCESS) { return EXIT_FAILURE; }
+    if(Leds::map() != MMIO_SUCCESS || Data::map() != MMIO_SUCCESS) { return EXIT_FAILURE; }
+
+    double start = bench_now();
+    for(long n = 0; n < iterations; n++) {
+        for(int i = 0; i < 4; i++) { mmio_set_high(leds[i]); }
+        for(int i = 0; i < 4; i++) { mmio_set_low(leds[i]); }
+    }
+    bench_report("gpio_t drive 4 pins", bench_now() - start, iterations);
+
+    start = bench_now();
+    for(long n = 0; n < iterations; n++) {
+        Leds::high();
+        Leds::low();
+    }
+    bench_report("Pins<> drive 4 pins", bench_now() - start, iterations);
+
+    uint32_t seen = 0;
+    start = bench_now();
+    for(long n = 0; n < iterations; n++) {
+        seen += mmio_input(data) != 0;
+    }
+    bench_report("gpio_t poll input", bench_now() - start, iterations);
+
+    start = bench_now();
+    for(long n = 0; n < iterations; n++) {
+        seen += Data::level();
+    }
+    bench_report("Pin<> poll input", bench_now() - start, iterations);
+
+    mmio_sim_sync(BENCH_BASE);
+    mmio_set_backend(nullptr);
+    return seen != 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+//============================================================================//
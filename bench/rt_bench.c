@@ -0,0 +1,205 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    rt_bench.c
+ * @version v1.0.1 -- CHANGELOG
+ *                  | v1.0.0 - Added scheduling and polling jitter benchmark
+ *                  | v1.0.1 - Real-time mode skipped when memory is not locked
+ *
+ * @note    cyclictest style measurement, run once at default priority, once
+ *          at FIFO priority as the readers use it and once with the real-time
+ *          mode of dht_rt.h:
+ *          - wake-up latency of a periodic absolute clock_nanosleep
+ *          - largest gap between two reads of DATAIN in a busy polling window
+ *            as long as a capture
+ *          FIFO priority and memory locking need root or CAP_SYS_NICE and
+ *          CAP_IPC_LOCK, load the system (e.g. stress-ng) to see a difference.
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <errno.h>
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "dht_rt.h"
+#include "mmio.h"
+#include "mmio_sim.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+typedef enum BENCH_MODE {
+    BENCH_NORMAL,
+    BENCH_FIFO,
+    BENCH_RT,
+    BENCH_MODES
+} bench_mode_e;
+
+static const char *BENCH_NAMES[BENCH_MODES] = { "normal", "fifo", "rt" };
+
+// Polling gaps above this are counted as missed edges of a capture
+static const double BENCH_GAP_LIMIT_US = 20.0;
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static int bench_cmp(const void *a, const void *b) {
+    double x = *(const double *) a;
+    double y = *(const double *) b;
+    return (x > y) - (x < y);
+}
+
+static void bench_stats(const char *name, double *values, int count, double limit) {
+    qsort(values, count, sizeof(double), bench_cmp);
+
+    double sum = 0.0;
+    int over = 0;
+    for(int i = 0; i < count; i++) {
+        sum += values[i];
+        over += values[i] > limit;
+    }
+    fprintf(stdout, "  %-10s min %8.1f  avg %8.1f  p99 %8.1f  max %8.1f us  (%d > %.0f us)\n",
+        name, values[0], sum / count, values[(int) (0.99 * (count - 1))], values[count - 1], over, limit);
+}
+
+static void bench_enter(bench_mode_e mode) {
+    if(mode != BENCH_NORMAL) { set_max_priority(); }
+}
+
+static void bench_leave(bench_mode_e mode) {
+    if(mode != BENCH_NORMAL) { set_default_priority(); }
+}
+
+static void bench_latency(bench_mode_e mode, int loops, uint32_t interval_us, double *latency) {
+    struct timespec next;
+    clock_gettime(CLOCK_MONOTONIC, &next);
+
+    bench_enter(mode);
+    for(int i = 0; i < loops; i++) {
+        next.tv_nsec += interval_us * 1000L;
+        while(next.tv_nsec >= 1000000000L) {
+            next.tv_nsec -= 1000000000L;
+            next.tv_sec++;
+        }
+        while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL) == EINTR);
+
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        latency[i] = ((now.tv_sec - next.tv_sec) * 1e9 + (now.tv_nsec - next.tv_nsec)) / 1e3;
+    }
+    bench_leave(mode);
+}
+
+static void bench_polling(bench_mode_e mode, gpio_t pin, int windows, uint32_t window_ms, double *gaps) {
+    const uint32_t tpus = dht_ticks_per_us();
+    const uint32_t window = window_ms * 1000 * tpus;
+    uint32_t seen = 0;
+
+    for(int w = 0; w < windows; w++) {
+        // Each window stands for one capture, entered like a reader does
+        bench_enter(mode);
+        uint32_t start = dht_ticks();
+        uint32_t last = start;
+        uint32_t worst = 0;
+        while(last - start < window) {
+            seen += mmio_input(pin) != 0;
+            uint32_t now = dht_ticks();
+            if(now - last > worst) { worst = now - last; }
+            last = now;
+        }
+        bench_leave(mode);
+
+        gaps[w] = (double) worst / tpus;
+        sleep_ms(10);
+    }
+
+    if(seen == 0) { fprintf(stderr, "Line never read high\n"); }
+}
+
+int main(int argc, char **argv) {
+    int loops = 2000;
+    uint32_t interval_us = 1000;
+    int windows = 200;
+    uint32_t window_ms = 5;
+    int devmem = 0;
+    int base = 0;
+    int num = 20;
+
+    int opt;
+    while((opt = getopt(argc, argv, "n:i:w:W:db:p:h")) != -1) {
+        switch(opt) {
+        case 'n': loops = atoi(optarg); break;
+        case 'i': interval_us = (uint32_t) atoi(optarg); break;
+        case 'w': windows = atoi(optarg); break;
+        case 'W': window_ms = (uint32_t) atoi(optarg); break;
+        case 'd': devmem = 1; break;
+        case 'b': base = atoi(optarg); break;
+        case 'p': num = atoi(optarg); break;
+        default:
+            fprintf(stderr,
+                "Usage: %s [options]\n"
+                "  -n <loops>    Periodic wake-ups per mode (default 2000)\n"
+                "  -i <us>       Wake-up interval (default 1000)\n"
+                "  -w <windows>  Polling windows per mode (default 200)\n"
+                "  -W <ms>       Polling window length (default 5)\n"
+                "  -d            Poll the real gpio through /dev/mem\n"
+                "  -b <base>     Gpio base polled with -d (default 0)\n"
+                "  -p <num>      GPIO number polled with -d (default 20)\n",
+                argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if(loops <= 0 || windows <= 0 || interval_us == 0 || window_ms == 0) { return EXIT_FAILURE; }
+
+    if(!devmem) { mmio_set_backend(&MMIO_BACKEND_SIM); }
+    gpio_t pin;
+    if(mmio_get_gpio(base, num, &pin) != MMIO_SUCCESS) {
+        fprintf(stderr, "Failed to map gpio%d_%d\n", base, num);
+        return EXIT_FAILURE;
+    }
+    mmio_set_input(pin);
+
+    double *latency = calloc(loops, sizeof(double));
+    double *gaps = calloc(windows, sizeof(double));
+    if(latency == NULL || gaps == NULL) { return EXIT_FAILURE; }
+
+    for(int mode = 0; mode < BENCH_MODES; mode++) {
+        if(mode == BENCH_RT) {
+            int result = dht_rt_enable(NULL);
+            if(result != DHT_SUCCESS) {
+                fprintf(stderr, "%s for the real-time mode\n",
+                    result == DHT_ERR_MEMORY ? "Memory can not be locked" : "No CPU");
+                break;
+            }
+            fprintf(stdout, "rt mode on CPU %d\n", dht_rt_cpu());
+        }
+
+        bench_latency(mode, loops, interval_us, latency);
+        bench_polling(mode, pin, windows, window_ms, gaps);
+
+        fprintf(stdout, "%s:\n", BENCH_NAMES[mode]);
+        bench_stats("wake-up", latency, loops, 100.0);
+        bench_stats("poll gap", gaps, windows, BENCH_GAP_LIMIT_US);
+    }
+
+    if(dht_rt_cpu() >= 0) {
+        fprintf(stdout, "FIFO bound overruns: %llu\n", (unsigned long long) dht_rt_overruns());
+        dht_rt_disable();
+    }
+
+    free(latency);
+    free(gaps);
+    return EXIT_SUCCESS;
+}
+//============================================================================//
@@ -0,0 +1,143 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    sample_bench.c
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added sampled capture benchmark
+ *
+ * @note    Synthesizes the DATAIN words of a DHT11 frame at a given sampling
+ *          rate, with jitter on every level and the other lines of the bank
+ *          toggling, and times the edge extraction and decoding of them.
+ *          Then runs the sampling loop on a gpio bank, simulated by default
+ *          or the real one with -d, to measure the reads per microsecond.
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "dht_decoder.h"
+#include "dht_sample.h"
+#include "mmio.h"
+#include "mmio_sim.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+static const uint8_t BENCH_FRAME[5] = { 45, 0, 23, 0, 68 };
+static const int BENCH_NUM = 20;
+
+static uint32_t words[DHT_SAMPLE_WORDS];
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static double bench_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static int bench_level(int at, int level, float us, float rate, float jitter, uint32_t mask) {
+    // Whole samples of the level, the other lines change at random
+    float spread = jitter * (2.0f * rand() / RAND_MAX - 1.0f);
+    int end = at + (int) ((us + spread) * rate + 0.5f);
+    if(end > DHT_SAMPLE_WORDS) { end = DHT_SAMPLE_WORDS; }
+    for(; at < end; at++) { words[at] = ((uint32_t) rand() & ~mask) | (level ? mask : 0); }
+    return at;
+}
+
+static int bench_frame(float rate, float jitter, uint32_t mask) {
+    int n = bench_level(0, 1, 30.0f, rate, 0.0f, mask);
+    n = bench_level(n, 0, 80.0f, rate, jitter, mask);
+    n = bench_level(n, 1, 80.0f, rate, jitter, mask);
+    for(int bit = 0; bit < 40; bit++) {
+        int one = (BENCH_FRAME[bit / 8] >> (7 - bit % 8)) & 1;
+        n = bench_level(n, 0, 50.0f, rate, jitter, mask);
+        n = bench_level(n, 1, one ? 70.0f : 27.0f, rate, jitter, mask);
+    }
+    n = bench_level(n, 0, 50.0f, rate, jitter, mask);
+    return bench_level(n, 1, (float) DHT_SAMPLE_WINDOW_US, rate, 0.0f, mask);
+}
+
+int main(int argc, char **argv) {
+    float rate = 5.0f;
+    float jitter = 2.0f;
+    int iterations = 1000;
+    int device = 0;
+
+    int opt;
+    while((opt = getopt(argc, argv, "r:j:i:dh")) != -1) {
+        switch(opt) {
+        case 'r': rate = (float) atof(optarg); break;
+        case 'j': jitter = (float) atof(optarg); break;
+        case 'i': iterations = atoi(optarg); break;
+        case 'd': device = 1; break;
+        default:
+            fprintf(stderr,
+                "Usage: %s [options]\n"
+                "  -r <rate>     Synthesized samples per microsecond (default 5)\n"
+                "  -j <us>       Jitter on every level in microseconds (default 2)\n"
+                "  -i <count>    Extractions to time (default 1000)\n"
+                "  -d            Measure the sampling rate on gpio0 of /dev/mem (root)\n",
+                argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if(rate <= 0.0f || iterations <= 0) { return EXIT_FAILURE; }
+
+    srand(1);
+    const uint32_t mask = 1u << BENCH_NUM;
+    int n = bench_frame(rate, jitter, mask);
+
+    uint32_t edges[DHT_RUNS_MAX + 2];
+    int found = 0;
+    double start = bench_now_ns();
+    for(int i = 0; i < iterations; i++) { found = dht_sample_edges(words, n, mask, edges, DHT_RUNS_MAX + 2); }
+    double used = (bench_now_ns() - start) / iterations;
+
+    uint32_t widths[DHT_RUNS_MAX];
+    dht_frame_t frame = { 0 };
+    int count = dht_sample_widths(words, mask, edges, found, 1000.0f / rate, widths);
+    int result = count < 0 ? DHT_ERR_TIMEOUT : dht_decode_frame(widths, count, 1, &frame);
+    int match = result == DHT_SUCCESS;
+    for(int i = 0; i < 5; i++) { match = match && frame.data[i] == BENCH_FRAME[i]; }
+
+    fprintf(stdout, "%d words at %.1f samples/us, jitter %.1f us: %d edges, %d widths\n",
+        n, rate, jitter, found, count);
+    fprintf(stdout, "  extraction  %.1f us/frame, %.2f ns/word (%s)\n", used / 1000.0, used / n,
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+        "neon"
+#else
+        "scalar"
+#endif
+        );
+    fprintf(stdout, "  decode      %s, confidence %.2f\n", match ? "correct" : "wrong", frame.confidence);
+
+    // The first capture learns the rate from a timed burst, the second one
+    // takes the window at that rate
+    if(!device) { mmio_set_backend(&MMIO_BACKEND_SIM); }
+    gpio_t pin;
+    if(mmio_get_gpio(0, BENCH_NUM, &pin) < 0) {
+        fprintf(stderr, "Failed to map gpio0\n");
+        return EXIT_FAILURE;
+    }
+    mmio_set_input(pin);
+    if(!device) { mmio_sim_sync(0); }
+    for(int i = 0; i < 2; i++) { dht_sample_capture(pin, widths, &count); }
+    fprintf(stdout, "  sampling    %.2f reads/us on the %s bank\n", dht_sample_rate() / 1000.0,
+        device ? "gpio0" : "simulated");
+
+    return match ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+//============================================================================//
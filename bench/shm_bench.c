@@ -0,0 +1,168 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    shm_bench.c
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added shared memory reading benchmark
+ *
+ * @note    A child process publishes readings as fast as it can while this
+ *          process reads them through a second mapping, checking every copy
+ *          for torn fields and timing the reads. With -w it is a client of
+ *          the running mirror instead and prints its readings.
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <getopt.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "dht_shm.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static uint64_t bench_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+static void bench_fill(dht_shm_reading_t *reading, uint32_t n) {
+    // Every field follows from n, a mix of two writes can not pass the check
+    reading->humidity = (float) (n % 100);
+    reading->temperature = -(float) (n % 100);
+    reading->filtered_humidity = reading->humidity;
+    reading->filtered_temperature = reading->temperature;
+    reading->humidity_min = reading->humidity_max = reading->humidity;
+    reading->temperature_min = reading->temperature_max = reading->temperature;
+    reading->status = (int32_t) (n % 7);
+    reading->reads = n;
+    reading->failures = n / 2;
+    reading->outliers = n / 3;
+    reading->time_ns = n;
+    reading->good_ns = (uint64_t) n * 2;
+}
+
+static int bench_check(const dht_shm_reading_t *reading) {
+    dht_shm_reading_t expected;
+    bench_fill(&expected, reading->reads);
+    return reading->humidity == expected.humidity && reading->temperature_max == expected.temperature_max &&
+        reading->status == expected.status && reading->failures == expected.failures &&
+        reading->outliers == expected.outliers && reading->time_ns == expected.time_ns &&
+        reading->good_ns == expected.good_ns;
+}
+
+static int bench_watch(int seconds) {
+    dht_shm_t shm;
+    int result = dht_shm_open(&shm, DHT_SHM_NAME);
+    if(result != DHT_SHM_SUCCESS) {
+        fprintf(stderr, "Failed to open %s: %d\n", DHT_SHM_NAME, result);
+        return EXIT_FAILURE;
+    }
+
+    fprintf(stdout, "Publisher pid %d\n", shm.seg->pid);
+    for(int s = 0; s < seconds; s++) {
+        dht_shm_reading_t reading;
+        if(dht_shm_read(&shm, 0, &reading) == DHT_SHM_SUCCESS) {
+            fprintf(stdout, "Humidity: %0.1f (%0.1f..%0.1f) Temperature: %0.1f (%0.1f..%0.1f) "
+                "Reads: %u Failures: %u Age: %.1f s\n",
+                reading.filtered_humidity, reading.humidity_min, reading.humidity_max,
+                reading.filtered_temperature, reading.temperature_min, reading.temperature_max,
+                reading.reads, reading.failures, (bench_now_ns() - reading.time_ns) / 1e9);
+        }
+        sleep(1);
+    }
+    dht_shm_close(&shm);
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char **argv) {
+    int count = 10000000;
+    int watch = 0;
+
+    int opt;
+    while((opt = getopt(argc, argv, "n:w:h")) != -1) {
+        switch(opt) {
+        case 'n': count = atoi(optarg); break;
+        case 'w': watch = atoi(optarg); break;
+        default:
+            fprintf(stderr,
+                "Usage: %s [options]\n"
+                "  -n <count>    Reads to time and check (default 10000000)\n"
+                "  -w <seconds>  Print the readings of the mirror instead\n",
+                argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if(watch > 0) { return bench_watch(watch); }
+    if(count <= 0) { return EXIT_FAILURE; }
+
+    char name[64];
+    snprintf(name, sizeof(name), "/dht_shm_bench_%d", (int) getpid());
+    dht_shm_t publisher;
+    if(dht_shm_create(&publisher, name) != DHT_SHM_SUCCESS) {
+        fprintf(stderr, "Failed to create %s\n", name);
+        return EXIT_FAILURE;
+    }
+
+    pid_t child = fork();
+    if(child < 0) {
+        dht_shm_close(&publisher);
+        return EXIT_FAILURE;
+    }
+    if(child == 0) {
+        // Publishes until killed, the parent only has its own mapping
+        dht_shm_reading_t reading;
+        for(uint32_t n = 1;; n++) {
+            bench_fill(&reading, n);
+            dht_shm_publish(&publisher, 0, &reading);
+        }
+    }
+
+    dht_shm_t client;
+    int result = dht_shm_open(&client, name);
+    uint64_t torn = 0;
+    uint64_t updates = 0;
+    uint32_t last = 0;
+    uint64_t start = bench_now_ns();
+    for(int i = 0; result == DHT_SHM_SUCCESS && i < count; i++) {
+        dht_shm_reading_t reading;
+        if(dht_shm_read(&client, 0, &reading) != DHT_SHM_SUCCESS) { continue; }
+        if(!bench_check(&reading)) { torn++; }
+        if(reading.reads != last) {
+            updates++;
+            last = reading.reads;
+        }
+    }
+    uint64_t used = bench_now_ns() - start;
+
+    kill(child, SIGKILL);
+    waitpid(child, NULL, 0);
+    dht_shm_close(&client);
+    dht_shm_close(&publisher);
+
+    if(result != DHT_SHM_SUCCESS) {
+        fprintf(stderr, "Failed to open %s: %d\n", name, result);
+        return EXIT_FAILURE;
+    }
+    fprintf(stdout, "%d reads against a busy publisher: %.1f ns/read, %llu new readings seen, %llu torn\n",
+        count, (double) used / count, (unsigned long long) updates, (unsigned long long) torn);
+    return torn == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+//============================================================================//
@@ -0,0 +1,120 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    trace_bench.c
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added trace point benchmark
+ *
+ * @note    Threads record spans into their rings as fast as they can, one of
+ *          them dumping the trace while the others keep going. Reports the
+ *          time per event and the events dumped. The events are recorded with
+ *          trace_event() directly, so the cost shows whether or not the trace
+ *          points of the libraries are built in.
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <getopt.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "trace.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+#define BENCH_THREADS_MAX       16
+
+typedef struct BENCH_THREAD {
+    pthread_t thread;
+    int index;
+    int events;
+    double ns;
+} bench_thread_t;
+
+static const char *BENCH_NAMES[BENCH_THREADS_MAX] = {
+    "worker 0", "worker 1", "worker 2", "worker 3", "worker 4", "worker 5", "worker 6", "worker 7",
+    "worker 8", "worker 9", "worker 10", "worker 11", "worker 12", "worker 13", "worker 14", "worker 15"
+};
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static double bench_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void *bench_worker(void *arg) {
+    bench_thread_t *self = arg;
+    trace_thread_name(BENCH_NAMES[self->index]);
+
+    double start = bench_now_ns();
+    for(int i = 0; i < self->events / 2; i++) {
+        trace_event(TRACE_PHASE_BEGIN, "span", 0);
+        trace_event(TRACE_PHASE_END, "span", 0);
+    }
+    self->ns = (bench_now_ns() - start) / self->events;
+    return NULL;
+}
+
+int main(int argc, char **argv) {
+    int threads = 2;
+    int events = 10000000;
+    const char *path = "trace_bench.json";
+
+    int opt;
+    while((opt = getopt(argc, argv, "t:n:o:h")) != -1) {
+        switch(opt) {
+        case 't': threads = atoi(optarg); break;
+        case 'n': events = atoi(optarg); break;
+        case 'o': path = optarg; break;
+        default:
+            fprintf(stderr,
+                "Usage: %s [options]\n"
+                "  -t <threads>  Recording threads (default 2, at most 16)\n"
+                "  -n <events>   Events per thread (default 10000000)\n"
+                "  -o <path>     Trace written at the end (default trace_bench.json)\n",
+                argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if(threads < 1 || threads > BENCH_THREADS_MAX || events < 2) { return EXIT_FAILURE; }
+
+    bench_thread_t workers[BENCH_THREADS_MAX];
+    for(int i = 0; i < threads; i++) {
+        workers[i].index = i;
+        workers[i].events = events;
+        if(pthread_create(&workers[i].thread, NULL, bench_worker, &workers[i]) != 0) { return EXIT_FAILURE; }
+    }
+
+    // Dumped while the workers record, then once more when they are done
+    trace_thread_name("dump");
+    double start = bench_now_ns();
+    int result = trace_dump(path);
+    double busy = bench_now_ns() - start;
+    for(int i = 0; i < threads; i++) { pthread_join(workers[i].thread, NULL); }
+    result = result == TRACE_SUCCESS ? trace_dump(path) : result;
+    if(result != TRACE_SUCCESS) {
+        fprintf(stderr, "Failed to write %s\n", path);
+        return EXIT_FAILURE;
+    }
+
+    for(int i = 0; i < threads; i++) {
+        fprintf(stdout, "worker %d: %d events, %.1f ns/event\n", i, events, workers[i].ns);
+    }
+    fprintf(stdout, "dump under load %.1f ms, %d events per thread kept in %s\n", busy / 1e6,
+        events < TRACE_EVENTS ? events : TRACE_EVENTS, path);
+    return EXIT_SUCCESS;
+}
+//============================================================================//
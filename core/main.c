@@ -1,14 +1,391 @@
 #include "main.h"
 
+// Mirror screen, readings only go to stdout when it can not be opened
+typedef struct SCREEN {
+    display_t disp;
+    display_font_t big;
+    display_font_t small;
+    display_pack_t pack;        // Prebuilt fonts and images, mapped
+    int clock;
+    int temperature;
+    int humidity;
+    int spark;
+} screen_t;
+
+// State kept across restarts, readings are only restored while recent
+typedef struct APP_STATE {
+    dht_shm_reading_t reading;
+    dht_filter_t humidity;
+    dht_filter_t temperature;
+    char shown_temperature[DISPLAY_TEXT_MAX + 1];
+    char shown_humidity[DISPLAY_TEXT_MAX + 1];
+} app_state_t;
+
+// Everything the jobs of the loop share, all of it used from the one thread
+typedef struct APP {
+    loop_t loop;
+    loop_watch_t signals;
+    dht_async_t sensor;
+    loop_timer_t sample;
+    loop_watch_t reading;
+    dht_filter_t humidity;      // Good readings filtered for display
+    dht_filter_t temperature;
+    dht_shm_t shm;              // Readings for other processes
+    int sharing;
+    dht_shm_reading_t shared;   // Latest readings, published when sharing
+    loop_timer_t clock;
+    loop_timer_t flush;
+    history_t history;
+    int logging;
+    loop_timer_t save;
+    screen_t screen;
+    int showing;
+    time_t minute;
+    char shown_temperature[DISPLAY_TEXT_MAX + 1];
+    char shown_humidity[DISPLAY_TEXT_MAX + 1];
+} app_t;
+
+static void screen_close(screen_t *screen) {
+    display_font_free(&screen->big);
+    display_font_free(&screen->small);
+    display_close(&screen->disp);
+    display_pack_close(&screen->pack);
+}
+
+static int screen_font(screen_t *screen, display_font_t *font, const char *name, uint32_t scale, int chars) {
+    // The atlas of the pack is used as mapped when its cells fit
+    display_t *disp = &screen->disp;
+    if(display_pack_font(&screen->pack, disp, name, font) == DISPLAY_SUCCESS &&
+       font->width * (uint32_t) chars <= disp->width) {
+        return 1;
+    }
+    return scale != 0 && display_font_init(font, disp, scale, SCREEN_FG, SCREEN_BG) == DISPLAY_SUCCESS;
+}
+
+static int screen_open(screen_t *screen, const char *device, const char *assets) {
+    display_t *disp = &screen->disp;
+    if(display_open(disp, device) != DISPLAY_SUCCESS) { return 0; }
+
+    // Without a pack for this display everything is rasterized here, a
+    // background goes under the widgets added after it
+    display_image_t background;
+    if(display_pack_open(&screen->pack, assets) == DISPLAY_SUCCESS &&
+       display_pack_image(&screen->pack, disp, "background", &background) == DISPLAY_SUCCESS) {
+        display_image(disp, 0, 0, &background);
+    }
+
+    // Clock across most of the width, readings at half its size below it and
+    // the temperature of the last hours at the bottom
+    uint32_t big = disp->width / (8 * 6 + 8);
+    uint32_t small = big / 2 ? big / 2 : 1;
+    int ok = screen_font(screen, &screen->big, "big", big, 8) &&
+        screen_font(screen, &screen->small, "small", small, 13);
+
+    int width = (int) disp->width;
+    int margin = width / 20;
+    int y = margin;
+    if(ok) {
+        screen->clock = display_text(disp, (width - 8 * (int) screen->big.width) / 2, y, 8, &screen->big);
+        y += (int) screen->big.height + margin;
+        screen->temperature = display_text(disp, margin, y, 7, &screen->small);
+        screen->humidity = display_text(disp, width - margin - 6 * (int) screen->small.width, y, 6, &screen->small);
+        y += (int) screen->small.height + margin;
+
+        display_rect_t area = { margin, y, width - 2 * margin, (int) disp->height - y - margin };
+        if(area.w > DISPLAY_SPARK_MAX) { area.w = DISPLAY_SPARK_MAX; }
+        screen->spark = display_spark(disp, area, SCREEN_DIM, SCREEN_BG);
+        ok = screen->clock >= 0 && screen->temperature >= 0 && screen->humidity >= 0 && screen->spark >= 0;
+    }
+    if(!ok) {
+        screen_close(screen);
+        return 0;
+    }
+
+    display_clear(disp, SCREEN_BG);
+    return 1;
+}
+
+static void screen_history(screen_t *screen, const history_t *history, uint32_t now) {
+    // One point per minute bucket, scaled to the range shown
+    float points[SCREEN_POINTS];
+    float lo = INFINITY;
+    float hi = -INFINITY;
+    for(int i = 0; i < SCREEN_POINTS; i++) {
+        uint32_t time = now - (uint32_t) (SCREEN_POINTS - 1 - i) * history_width(HISTORY_MINUTE);
+        const history_bucket_t *bucket = history_bucket(history, 0, HISTORY_MINUTE, time);
+        points[i] = bucket != NULL ? history_temperature(bucket) : NAN;
+        if(bucket != NULL && points[i] < lo) { lo = points[i]; }
+        if(bucket != NULL && points[i] > hi) { hi = points[i]; }
+    }
+    display_set_spark(&screen->disp, screen->spark, points, SCREEN_POINTS, lo - 1.0f, hi + 1.0f);
+}
+
+static void screen_readings(screen_t *screen, const char *temperature, const char *humidity) {
+    display_set_text(&screen->disp, screen->temperature, temperature);
+    display_set_text(&screen->disp, screen->humidity, humidity);
+    display_update(&screen->disp);
+}
+
+static uint64_t app_rebase(uint64_t time_ns, uint64_t now_ns, uint64_t age_ns) {
+    // Monotonic times restart with the system, 0 stays never
+    if(time_ns == 0) { return 0; }
+    return now_ns > age_ns ? now_ns - age_ns : 1;
+}
+
+static void app_restore(app_t *app) {
+    snapshot_t snap;
+    if(snapshot_open(&snap, SNAPSHOT_PATH, APP_STATE_VERSION, sizeof(app_state_t)) != SNAPSHOT_SUCCESS) { return; }
+    const app_state_t *state = snap.data;
+
+    // Shown at once, replaced by the first reading
+    snprintf(app->shown_temperature, sizeof(app->shown_temperature), "%s", state->shown_temperature);
+    snprintf(app->shown_humidity, sizeof(app->shown_humidity), "%s", state->shown_humidity);
+
+    // Filters resume warm unless the readings went stale or the wall clock is
+    // not set yet, a window of old readings would hold back new ones
+    int64_t age = (int64_t) time(NULL) - snap.header->time;
+    int same = !memcmp(&state->humidity.cfg, &app->humidity.cfg, sizeof(dht_filter_cfg_t)) &&
+        !memcmp(&state->temperature.cfg, &app->temperature.cfg, sizeof(dht_filter_cfg_t));
+    if(same && age >= 0 && age <= SNAPSHOT_WARM_S) {
+        uint64_t now = dht_now_ns();
+        uint64_t age_ns = (uint64_t) age * 1000000000ULL;
+        app->humidity = state->humidity;
+        app->temperature = state->temperature;
+        app->shared = state->reading;
+        app->humidity.time_ns = app_rebase(state->humidity.time_ns, now, age_ns);
+        app->temperature.time_ns = app_rebase(state->temperature.time_ns, now, age_ns);
+        app->shared.time_ns = app_rebase(state->reading.time_ns, now, age_ns);
+        app->shared.good_ns = app_rebase(state->reading.good_ns, now, age_ns);
+    }
+    snapshot_close(&snap);
+}
+
+static void app_save(app_t *app) {
+    static app_state_t state;
+    memset(&state, 0, sizeof(state));
+    state.reading = app->shared;
+    state.humidity = app->humidity;
+    state.temperature = app->temperature;
+    memcpy(state.shown_temperature, app->shown_temperature, sizeof(state.shown_temperature));
+    memcpy(state.shown_humidity, app->shown_humidity, sizeof(state.shown_humidity));
+    if(snapshot_write(SNAPSHOT_PATH, APP_STATE_VERSION, &state, sizeof(state)) != SNAPSHOT_SUCCESS) {
+        fprintf(stderr, "Failed to write %s\n", SNAPSHOT_PATH);
+    }
+}
+
+static void app_share(app_t *app, int status, float humidity, float temperature) {
+    dht_shm_reading_t *shared = &app->shared;
+    shared->status = status;
+    shared->reads++;
+    shared->time_ns = dht_now_ns();
+    if(status != DHT_SUCCESS) {
+        shared->failures++;
+    } else {
+        float h = app->humidity.value;
+        float t = app->temperature.value;
+        if(shared->good_ns == 0 || h < shared->humidity_min) { shared->humidity_min = h; }
+        if(shared->good_ns == 0 || h > shared->humidity_max) { shared->humidity_max = h; }
+        if(shared->good_ns == 0 || t < shared->temperature_min) { shared->temperature_min = t; }
+        if(shared->good_ns == 0 || t > shared->temperature_max) { shared->temperature_max = t; }
+        shared->humidity = humidity;
+        shared->temperature = temperature;
+        shared->filtered_humidity = h;
+        shared->filtered_temperature = t;
+        shared->outliers = app->humidity.outliers + app->temperature.outliers;
+        shared->good_ns = shared->time_ns;
+    }
+    if(app->sharing) { dht_shm_publish(&app->shm, 0, shared); }
+}
+
+static void on_signal(loop_t *loop, loop_watch_t *watch, uint32_t events) {
+    struct signalfd_siginfo info;
+    if(read(watch->fd, &info, sizeof(info)) != sizeof(info)) { return; }
+
+    // SIGUSR1 takes a look at the trace points without stopping
+    if(info.ssi_signo != SIGUSR1) {
+        loop_stop(loop);
+    } else if(trace_dump(TRACE_PATH) != TRACE_SUCCESS) {
+        fprintf(stderr, "Failed to write %s\n", TRACE_PATH);
+    }
+}
+
+static void on_sample(loop_t *loop, loop_timer_t *timer) {
+    app_t *app = timer->arg;
+    int result = dht_start(&app->sensor);
+    if(result != DHT_SUCCESS && result != DHT_PENDING) {
+        fprintf(stderr, "Failed to start a DHT read: %d\n", result);
+    }
+}
+
+static void on_reading(loop_t *loop, loop_watch_t *watch, uint32_t events) {
+    app_t *app = watch->arg;
+    float humidity = NAN;
+    float temperature = NAN;
+    int status = dht_poll(&app->sensor, &humidity, &temperature);
+    if(status == DHT_PENDING) { return; }
+
+    // Spikes and noise stay out of the screen and the history, failed reads
+    // are logged with their status and the last filtered values
+    if(status == DHT_SUCCESS) {
+        uint64_t now = dht_now_ns();
+        dht_filter_update(&app->humidity, humidity, now);
+        dht_filter_update(&app->temperature, temperature, now);
+    }
+    app_share(app, status, humidity, temperature);
+    fprintf(stdout, "Humidity: %0.3f (%0.3f) Temperature: %0.3f (%0.3f) Status: %d\n",
+        app->humidity.value, humidity, app->temperature.value, temperature, status);
+    if(app->logging) {
+        history_append(&app->history, 0, (uint32_t) time(NULL), app->temperature.value,
+            app->humidity.value, status);
+    }
+    if(status == DHT_SUCCESS) {
+        snprintf(app->shown_temperature, sizeof(app->shown_temperature), "%.1f\xb0" "C", app->temperature.value);
+        snprintf(app->shown_humidity, sizeof(app->shown_humidity), "%.1f%%", app->humidity.value);
+        if(app->showing) { screen_readings(&app->screen, app->shown_temperature, app->shown_humidity); }
+    }
+}
+
+static void on_clock(loop_t *loop, loop_timer_t *timer) {
+    app_t *app = timer->arg;
+    time_t now = time(NULL);
+    struct tm local;
+    localtime_r(&now, &local);
+
+    char text[DISPLAY_TEXT_MAX + 1];
+    strftime(text, sizeof(text), "%H:%M:%S", &local);
+    display_set_text(&app->screen.disp, app->screen.clock, text);
+    if(app->logging && now / 60 != app->minute) {
+        screen_history(&app->screen, &app->history, (uint32_t) now);
+        app->minute = now / 60;
+    }
+    display_update(&app->screen.disp);
+}
+
+static void on_flush(loop_t *loop, loop_timer_t *timer) {
+    app_t *app = timer->arg;
+    history_sync(&app->history);
+}
+
+static void on_save(loop_t *loop, loop_timer_t *timer) {
+    app_save(timer->arg);
+}
+
 int main(int argc, char **argv) {
     fprintf(stdout, "Initializing application\n");
+    static app_t app;
+
+    // Every job runs from this loop on the main thread
+    if(loop_init(&app.loop) != LOOP_SUCCESS) {
+        fprintf(stderr, "Failed to create the event loop\n");
+        return EXIT_FAILURE;
+    }
+
+    // SIGINT/SIGTERM arrive as reads, they stop the loop between two jobs.
+    // SIGUSR1 dumps the trace points, when built with TRACE_ENABLED.
+    TRACE_THREAD("main");
+    sigset_t mask;
+    sigemptyset(&mask);
+    sigaddset(&mask, SIGINT);
+    sigaddset(&mask, SIGTERM);
+    sigaddset(&mask, SIGUSR1);
+    sigprocmask(SIG_BLOCK, &mask, NULL);
+    int sfd = signalfd(-1, &mask, SFD_NONBLOCK | SFD_CLOEXEC);
+    if(sfd < 0 || loop_watch(&app.loop, &app.signals, sfd, EPOLLIN, on_signal, &app) != LOOP_SUCCESS) {
+        fprintf(stderr, "Failed to watch for signals\n");
+        return EXIT_FAILURE;
+    }
+
+    // The last saved state draws the first frame before anything slow runs
+    dht_filter_init(&app.humidity, &DHT_FILTER_HUMIDITY);
+    dht_filter_init(&app.temperature, &DHT_FILTER_TEMPERATURE);
+    app_restore(&app);
+
+    // Only the parts of the screen that changed are redrawn. The clock ticks
+    // on the wall clock second, the readings redraw as they arrive.
+    app.showing = screen_open(&app.screen, DISPLAY_DEVICE, ASSET_PATH);
+    if(!app.showing) {
+        fprintf(stderr, "Failed to open %s, display disabled\n", DISPLAY_DEVICE);
+    } else {
+        struct timespec wall;
+        clock_gettime(CLOCK_REALTIME, &wall);
+        loop_timer_init(&app.clock, on_clock, &app);
+        loop_timer_start(&app.loop, &app.clock, (uint32_t) (1000 - wall.tv_nsec / 1000000), 1000, CLOCK_SLACK_MS);
+        if(app.shown_temperature[0] != '\0') {
+            screen_readings(&app.screen, app.shown_temperature, app.shown_humidity);
+        }
+        on_clock(&app.loop, &app.clock);
+    }
+
+    // Raw captures are only kept when asked for, for offline dht_replay
+    const char *trace = getenv("DHT_TRACE");
+    if(trace != NULL && dht_trace_open(trace) != DHT_SUCCESS) {
+        fprintf(stderr, "Failed to open trace %s\n", trace);
+    }
+
+    // Read metrics for a scraper, one snapshot per connection
+    int serving = dht_metrics_serve(METRICS_PATH) == DHT_SUCCESS;
+    if(!serving) {
+        fprintf(stderr, "Failed to serve %s, metrics disabled\n", METRICS_PATH);
+    }
+
+    // Loop speed for count captures, measured once per build and CPU
+    if(dht_calibrate(0, 20, DHT_CALIBRATION_PATH) != DHT_SUCCESS) {
+        fprintf(stderr, "Failed to calibrate the DHT polling loop\n");
+    }
+
+    // A read waits on its timerfd between steps, only the bit capture blocks
+    int sensing = dht_async_init(&app.sensor, DHT11, 0, 20) == DHT_SUCCESS &&
+        loop_watch(&app.loop, &app.reading, dht_fd(&app.sensor), EPOLLIN, on_reading, &app) == LOOP_SUCCESS;
+    if(!sensing) {
+        fprintf(stderr, "Failed to set up the DHT sensor, readings disabled\n");
+    } else {
+        loop_timer_init(&app.sample, on_sample, &app);
+        loop_timer_start(&app.loop, &app.sample, 0, SAMPLE_PERIOD_MS, SAMPLE_SLACK_MS);
+    }
+
+    // Other processes read the readings from shared memory, not the sensor
+    int shared = dht_shm_create(&app.shm, DHT_SHM_NAME);
+    app.sharing = shared == DHT_SHM_SUCCESS;
+    if(shared == DHT_SHM_ERR_BUSY) {
+        fprintf(stderr, "%s is published by another running process, sharing disabled\n", DHT_SHM_NAME);
+    } else if(!app.sharing) {
+        fprintf(stderr, "Failed to create %s, sharing disabled\n", DHT_SHM_NAME);
+    } else if(app.shared.reads != 0) {
+        dht_shm_publish(&app.shm, 0, &app.shared);
+    }
+
+    // Readings are kept on disk for the charts, the mirror runs without it
+    app.logging = history_open(&app.history, HISTORY_PATH, HISTORY_RECORDS) == HISTORY_SUCCESS;
+    if(!app.logging) {
+        fprintf(stderr, "Failed to open %s, history disabled\n", HISTORY_PATH);
+    } else {
+        loop_timer_init(&app.flush, on_flush, &app);
+        loop_timer_start(&app.loop, &app.flush, HISTORY_FLUSH_MS, HISTORY_FLUSH_MS, HISTORY_FLUSH_MS / 6);
+    }
+
+    // Saved now and then and on exit, rarely enough to spare the flash
+    loop_timer_init(&app.save, on_save, &app);
+    loop_timer_start(&app.loop, &app.save, SNAPSHOT_PERIOD_MS, SNAPSHOT_PERIOD_MS, SNAPSHOT_PERIOD_MS / 6);
+
+    int result = loop_run(&app.loop);
+    if(result != LOOP_SUCCESS) {
+        fprintf(stderr, "Event loop failed: %d\n", result);
+    }
 
-    float humidity = 0.0f;
-    float temperature = 0.0f;
+    app_save(&app);
+    if(app.showing) { screen_close(&app.screen); }
 
-    int result = dht_read(DHT11, 0, 20, &humidity, &temperature);
-    fprintf(stdout, "Humidity: %0.3f Temperature: %0.3f\n", humidity, temperature);
+    dht_async_close(&app.sensor);
+    if(app.sharing) { dht_shm_close(&app.shm); }
+    dht_trace_close();
+    if(serving) { dht_metrics_stop(); }
+    if(app.logging) {
+        history_sync(&app.history);
+        history_close(&app.history);
+    }
+    loop_close(&app.loop);
+    close(sfd);
 
     fprintf(stdout, "Application complete... EXITING.\n");
-    return EXIT_SUCCESS;
+    return result == LOOP_SUCCESS ? EXIT_SUCCESS : EXIT_FAILURE;
 }
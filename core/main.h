@@ -6,7 +6,45 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <stddef.h>
+#include <signal.h>
+#include <time.h>
+#include <math.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/signalfd.h>
 
 #include "dht11.h"
+#include "dht_async.h"
+#include "dht_calibrate.h"
+#include "dht_filter.h"
+#include "dht_metrics.h"
+#include "dht_shm.h"
+#include "dht_trace.h"
+#include "display.h"
+#include "display_pack.h"
+#include "history.h"
+#include "loop.h"
+#include "snapshot.h"
+#include "trace.h"
+
+#define DHT_CALIBRATION_PATH    "dht_calibration.bin"
+#define HISTORY_PATH            "history.bin"
+#define HISTORY_RECORDS         65536
+#define HISTORY_FLUSH_MS        60000
+#define SNAPSHOT_PATH           "snapshot.bin"
+#define TRACE_PATH              "trace.json"
+#define METRICS_PATH            "dht_metrics.sock"
+#define SNAPSHOT_PERIOD_MS      300000
+#define SNAPSHOT_WARM_S         900
+#define APP_STATE_VERSION       2
+#define SAMPLE_PERIOD_MS        2000
+#define SAMPLE_SLACK_MS         100
+#define CLOCK_SLACK_MS          10
+#define DISPLAY_DEVICE          "/dev/fb0"
+#define ASSET_PATH              "mirror.pack"
+#define SCREEN_POINTS           120
+#define SCREEN_BG               0x000000
+#define SCREEN_FG               0xFFFFFF
+#define SCREEN_DIM              0x8090A0
 
 #endif //__MAIN_H__
@@ -11,8 +11,16 @@
  * @author  Syed Asad Amin
  * @date    Nov 30th, 2022
  * @file    dht11.c
- * @version v1.0.0 -- CHANGELOG
+ * @version v1.8.0 -- CHANGELOG
  *                  | v1.0.0 - Added DHT sensor readout function
+ *                  | v1.1.0 - Added time-stamped edge capture
+ *                  | v1.2.0 - Recording of read metrics
+ *                  | v1.3.0 - Decoding through dht_decode_frame
+ *                  | v1.4.0 - Recording of capture traces
+ *                  | v1.5.0 - FIFO priority only from the start signal on
+ *                  | v1.6.0 - Capture through the GPIO character device
+ *                  | v1.7.0 - Trace points on the read steps
+ *                  | v1.8.0 - Metrics from the decoded frame
  * 
  * @note    This is a library written in standard C to interface DHT11 sensor
  *          on beagle bone black
@@ -27,116 +35,86 @@
 #include <string.h>
 
 #include "dht11.h"
+#include "dht_capture.h"
+#include "dht_line.h"
+#include "dht_metrics.h"
+#include "dht_trace.h"
 #include "mmio.h"
+#include "trace.h"
 //============================================================================//
 
 //===== CONSTANTS AND VARIABLES ==============================================//
-static const uint32_t DHT_MAXCOUNT  = 32000;
-static const uint32_t DHT_PULSES    = 41;
 //============================================================================//
 
 //===== FUNCTION DEFINITION ==================================================//
-int dht_read(int type, int base, int num, float *humidity, float *temperature) {
-    // Parameters validity checks
-    if(humidity == NULL || temperature == NULL) { return DHT_ERR_ARGUMENT; }
-    *humidity = 0.0f;
-    *temperature = 0.0f;
-
-    int pulseCounts[DHT_PULSES * 2];
-    memset(pulseCounts, 0, sizeof(pulseCounts));
-
+static int dht_capture_mmio(int base, int num, dht_capture_e mode, uint32_t *pulses, int *count,
+    uint64_t *capture_ns) {
     // Get gpio pin and set as output
     gpio_t pin;
     if(mmio_get_gpio(base, num, &pin) < 0) { return DHT_ERR_GPIO; }
     mmio_set_output(pin);
 
-    // Making sure process becomes faster and avoid kernel context switching
-    set_max_priority();
-
     // Sending pulse to DHT sensor to let it know to start transmission of
     // 40 data bits
+    TRACE_BEGIN("dht_start");
     mmio_set_high(pin);
-    sleep_ms(500);\
+    sleep_ms(DHT_START_HIGH_MS);
+
+    // Making sure process becomes faster and avoid kernel context switching.
+    // The high level sleeps, only the start signal and capture run at FIFO.
+    set_max_priority();
     mmio_set_low(pin);
-    block_wait_ms(20);
+    block_wait_ms(DHT_START_LOW_MS);
+    TRACE_END("dht_start");
 
     // Set gpio pin as input
     mmio_set_input(pin);
 
-    // Wait for DHT to pull pin low.
-    uint32_t count = 0;
-    while(mmio_input(pin)) {
-        if(++count >= DHT_MAXCOUNT) {
-            set_default_priority();
-            return DHT_ERR_TIMEOUT;
-        }
-    }
-
-    // Record pulse
-    for(int i = 0; i < DHT_PULSES * 2; i+=2) {
-        // Check for pin low and store it
-        while(!mmio_input(pin)) {
-            if(++pulseCounts[i] >= DHT_MAXCOUNT) {
-                set_default_priority();
-                return DHT_ERR_TIMEOUT;
-            }
-        }
-
-        // Check for pin high and store it
-        while(mmio_input(pin)) {
-            if(++pulseCounts[i+1] >= DHT_MAXCOUNT) {
-                set_default_priority();
-                return DHT_ERR_TIMEOUT;
-            }
-        }
-    }
+    TRACE_BEGIN("dht_capture");
+    uint64_t capture = dht_now_ns();
+    int result = dht_capture(pin, mode, pulses, count);
+    *capture_ns = dht_now_ns() - capture;
+    TRACE_END("dht_capture");
 
     // Set back to default priority since critical task section is complete
     set_default_priority();
+    return result;
+}
 
-    // Get the average low pulse width to use as 50 microsec reference threshold
-    uint32_t threshold = 0;
-    for(int i = 2; i < DHT_PULSES * 2; i+=2) {
-        threshold += pulseCounts[i];
-    }
-    threshold /= DHT_PULSES - 1;
+int dht_read(int type, int base, int num, float *humidity, float *temperature) {
+    // Parameters validity checks
+    if(humidity == NULL || temperature == NULL) { return DHT_ERR_ARGUMENT; }
+    *humidity = 0.0f;
+    *temperature = 0.0f;
 
-    // Interpreting pulses
-    uint8_t data[5] = { 0 };
-    for(int i = 3; i < DHT_PULSES * 2; i+=2) {
-        int index = (i-3) / 16;
-        data[index] <<= 1;
-        if(pulseCounts[i] >= threshold) {
-            data[index] |= 1;
-        }
+    uint32_t pulses[DHT_RUNS_MAX];
+    int count = 0;
+    dht_capture_e mode = dht_capture_mode();
+    dht_frame_t frame = { .status = DHT_ERR_TIMEOUT };
+    uint64_t start = dht_now_ns();
+    TRACE_BEGIN("dht_read");
+
+    // Edge events sleep through the frame, the other modes poll DATAIN
+    uint64_t capture = 0;
+    int result = mode == DHT_CAPTURE_EVENT ?
+        dht_line_capture(base, num, pulses, &count, &capture) :
+        dht_capture_mmio(base, num, mode, pulses, &count, &capture);
+    if(result == DHT_ERR_GPIO) {
+        dht_metrics_record(base, num, DHT_ERR_GPIO, dht_now_ns() - start, 0, mode, NULL);
+        TRACE_END("dht_read");
+        return DHT_ERR_GPIO;
     }
 
-    // Debugging only
-    // fprintf(stdout, "Data: 0x%x 0x%x 0x%x 0x%x 0x%x\n", data[0], data[1], data[2], data[3], data[4]);
-
-    // Verify CSUM
-    uint8_t csum = (data[0] + data[1] + data[2] + data[3]) & 0xFF;
-    if(csum == data[4]) {
-        if(type == DHT11) {
-            float decimal = 0.0f;
-            
-            *humidity = (float) data[0];
-            decimal = (float) data[1];
-            *humidity += decimal;
-
-            *temperature = (float) data[2];
-            decimal = (float) data[3];
-            *temperature += decimal;
-        } else if(type == DHT22) {
-            *humidity = (data[0] * 256 + data[1]) / 10.0f;
-            *temperature = ((data[2] * 0x7F) * 256 + data[3]) / 10.0f;
-            if(data[2] & 0x80) {
-                *temperature *= -1.0f;
-            }
-        }
-        return DHT_SUCCESS;
-    } else {
-        return DHT_ERR_CHECKSUM;
+    TRACE_COUNTER("dht_pulses", count);
+    if(result == DHT_SUCCESS) {
+        TRACE_BEGIN("dht_decode");
+        result = dht_decode(type, mode, pulses, count, &frame, humidity, temperature);
+        TRACE_END("dht_decode");
     }
+
+    dht_trace_record(type, base, num, mode, result, pulses, count);
+    dht_metrics_record(base, num, result, dht_now_ns() - start, capture, mode, &frame);
+    TRACE_END("dht_read");
+    return result;
 }
 //============================================================================//
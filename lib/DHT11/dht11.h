@@ -11,8 +11,11 @@
  * @author  Syed Asad Amin
  * @date    Nov 30th, 2022
  * @file    dht11.h
- * @version v1.0.0 -- CHANGELOG
+ * @version v1.3.0 -- CHANGELOG
  *                  | v1.0.0 - Added DHT sensor readout function
+ *                  | v1.1.0 - Added time-stamped edge capture
+ *                  | v1.2.0 - Added GPIO character device capture
+ *                  | v1.3.0 - Added capture-then-decode sampling
  * 
  * @note    This is a library written in standard C to interface DHT11 sensor
  *          on beagle bone black
@@ -45,6 +48,23 @@
  *       and checksum etc.
  */
 int dht_read(int type, int base, int num, float *humidity, float *temperature);
+
+/*!
+ * @brief Selects how dht_read measures the pulse widths. DHT_CAPTURE_TIME
+ *        (default) timestamps each edge and decodes from microseconds with
+ *        time based timeouts. DHT_CAPTURE_COUNT counts loop iterations, which
+ *        depends on CPU frequency and load, call dht_calibrate() first to
+ *        derive its timeouts from the measured loop speed. DHT_CAPTURE_EVENT
+ *        reads through the GPIO character device with kernel timestamped
+ *        edges, sleeping during the frame (dht_line.h). DHT_CAPTURE_SAMPLE
+ *        stores DATAIN for a fixed window and finds the edges afterwards, at
+ *        the highest and steadiest rate the bus allows (dht_sample.h). The
+ *        bank reader always timestamps and the non-blocking one polls DATAIN
+ *        in event mode.
+ * @param [mode] dht_capture_e - Capture mode
+ * @return None
+ */
+void dht_set_capture(dht_capture_e mode);
 //============================================================================//
 
 #endif //__DHT11_H__
@@ -0,0 +1,155 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_async.c
+ * @version v1.4.0 -- CHANGELOG
+ *                  | v1.0.0 - Added non-blocking start/poll readout
+ *                  | v1.1.0 - Decoding through dht_decode_frame
+ *                  | v1.2.0 - Recording of capture traces
+ *                  | v1.3.0 - Trace points on the read steps
+ *                  | v1.4.0 - Metrics from the decoded frame
+ *
+ * @note    This is a library written in standard C to interface DHT11 sensor
+ *          on beagle bone black
+ *
+ * @sa      doc/DHT11_Technical_Reference.pdf
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <errno.h>
+#include <string.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+#include "dht_async.h"
+#include "dht_capture.h"
+#include "dht_metrics.h"
+#include "dht_trace.h"
+#include "trace.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static int dht_async_arm(dht_async_t *dev, uint32_t ms) {
+    struct itimerspec spec;
+    memset(&spec, 0, sizeof(spec));
+    spec.it_value.tv_sec = ms / 1000;
+    spec.it_value.tv_nsec = (ms % 1000) * 1000000L;
+    return timerfd_settime(dev->fd, 0, &spec, NULL);
+}
+
+int dht_async_init(dht_async_t *dev, int type, int base, int num) {
+    if(dev == NULL) { return DHT_ERR_ARGUMENT; }
+
+    memset(dev, 0, sizeof(*dev));
+    dev->type = type;
+    dev->base = base;
+    dev->num = num;
+    dev->fd = -1;
+    dev->state = DHT_STATE_IDLE;
+
+    // Map the bank up front so later steps never fail on it
+    gpio_t pin;
+    if(mmio_get_gpio(base, num, &pin) < 0) { return DHT_ERR_GPIO; }
+
+    dev->fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if(dev->fd == -1) { return DHT_ERR_ARGUMENT; }
+
+    return DHT_SUCCESS;
+}
+
+void dht_async_close(dht_async_t *dev) {
+    if(dev == NULL || dev->fd < 0) { return; }
+    close(dev->fd);
+    dev->fd = -1;
+    dev->state = DHT_STATE_IDLE;
+}
+
+int dht_start(dht_async_t *dev) {
+    if(dev == NULL || dev->fd < 0) { return DHT_ERR_ARGUMENT; }
+    if(dev->state != DHT_STATE_IDLE) { return DHT_PENDING; }
+
+    gpio_t pin;
+    if(mmio_get_gpio(dev->base, dev->num, &pin) < 0) { return DHT_ERR_GPIO; }
+    dev->start_ns = dht_now_ns();
+    TRACE_INSTANT("dht_start_high");
+    mmio_set_output(pin);
+    mmio_set_high(pin);
+
+    if(dht_async_arm(dev, DHT_START_HIGH_MS) < 0) { return DHT_ERR_ARGUMENT; }
+    dev->state = DHT_STATE_HIGH;
+    return DHT_SUCCESS;
+}
+
+int dht_poll(dht_async_t *dev, float *humidity, float *temperature) {
+    if(dev == NULL || humidity == NULL || temperature == NULL) { return DHT_ERR_ARGUMENT; }
+    if(dev->state == DHT_STATE_IDLE) { return DHT_ERR_ARGUMENT; }
+
+    // Nothing to do until the current wait expired
+    uint64_t expirations = 0;
+    if(read(dev->fd, &expirations, sizeof(expirations)) != sizeof(expirations)) {
+        return errno == EAGAIN ? DHT_PENDING : DHT_ERR_ARGUMENT;
+    }
+
+    gpio_t pin;
+    if(mmio_get_gpio(dev->base, dev->num, &pin) < 0) {
+        dev->state = DHT_STATE_IDLE;
+        return DHT_ERR_GPIO;
+    }
+
+    if(dev->state == DHT_STATE_HIGH) {
+        // Start signal, the sensor only needs it to last long enough
+        TRACE_INSTANT("dht_start_low");
+        mmio_set_low(pin);
+        if(dht_async_arm(dev, DHT_START_LOW_MS) < 0) {
+            dev->state = DHT_STATE_IDLE;
+            return DHT_ERR_ARGUMENT;
+        }
+        dev->state = DHT_STATE_LOW;
+        return DHT_PENDING;
+    }
+
+    // Release the line and capture the response, the only busy-wait
+    uint32_t pulses[DHT_RUNS_MAX];
+    int count = 0;
+    dht_capture_e mode = dht_capture_mode();
+    dht_frame_t frame = { .status = DHT_ERR_TIMEOUT };
+
+    set_max_priority();
+    mmio_set_input(pin);
+    TRACE_BEGIN("dht_capture");
+    uint64_t capture = dht_now_ns();
+    int result = dht_capture(pin, mode, pulses, &count);
+    capture = dht_now_ns() - capture;
+    TRACE_END("dht_capture");
+    set_default_priority();
+
+    dev->state = DHT_STATE_IDLE;
+    TRACE_COUNTER("dht_pulses", count);
+    if(result == DHT_SUCCESS) {
+        TRACE_BEGIN("dht_decode");
+        result = dht_decode(dev->type, mode, pulses, count, &frame, humidity, temperature);
+        TRACE_END("dht_decode");
+    }
+
+    dht_trace_record(dev->type, dev->base, dev->num, mode, result, pulses, count);
+    dht_metrics_record(dev->base, dev->num, result, dht_now_ns() - dev->start_ns, capture, mode, &frame);
+    return result;
+}
+
+int dht_fd(const dht_async_t *dev) {
+    return dev == NULL ? -1 : dev->fd;
+}
+//============================================================================//
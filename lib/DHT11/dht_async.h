@@ -0,0 +1,92 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_async.h
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added non-blocking start/poll readout
+ *
+ * @note    The read is split in a state machine whose waits are exposed as a
+ *          timerfd. Add dht_fd() to poll/epoll, call dht_poll() whenever it is
+ *          readable. Only the final bit capture busy-waits (~4 ms).
+ *
+ * @sa      doc/DHT11_Technical_Reference.pdf
+ *
+ */
+
+#ifndef __DHT_ASYNC_H__
+#define __DHT_ASYNC_H__
+
+//===== INCLUDE ==============================================================//
+#include "dht_common.h"
+//============================================================================//
+
+//===== TYPES, CONSTANTS AND VARIABLES =======================================//
+typedef enum DHT_STATE {
+    DHT_STATE_IDLE,                         // No read in progress
+    DHT_STATE_HIGH,                         // Line held high before start
+    DHT_STATE_LOW                           // Start signal, line pulled low
+} dht_state_e;
+
+typedef struct DHT_ASYNC {
+    int type;
+    int base;
+    int num;
+    int fd;                                 // timerfd of the current wait
+    dht_state_e state;
+    uint64_t start_ns;                      // Time dht_start was called
+} dht_async_t;
+//============================================================================//
+
+//===== FUNCTION DECLARATION =================================================//
+/*!
+ * @brief Prepares a sensor for non-blocking reads
+ * @param [dev] dht_async_t - Sensor to initialize
+ * @param [type] int - Type of sensor i.e. DHT11, DHT22 etc.
+ * @param [base] int - Gpio base where the sensor is connected (0..3)
+ * @param [num] int - GPIO pin number where the sensor is connected (0..31)
+ * @return 0 if success else negative values for various possible errors
+ */
+int dht_async_init(dht_async_t *dev, int type, int base, int num);
+
+/*!
+ * @brief Releases the timerfd of a sensor
+ * @param [dev] dht_async_t - Sensor to close
+ * @return None
+ */
+void dht_async_close(dht_async_t *dev);
+
+/*!
+ * @brief Starts a read, the line is driven high and the timer armed
+ * @param [dev] dht_async_t - Sensor to read
+ * @return 0 if success else negative values for various possible errors
+ */
+int dht_start(dht_async_t *dev);
+
+/*!
+ * @brief Advances the read once the timer of dht_fd() expired
+ * @param [dev] dht_async_t - Sensor being read
+ * @param [humidity] float - Output of humidity value once complete
+ * @param [temperature] float - Output of temperature value once complete
+ * @return DHT_PENDING while waiting, 0 if the read succeeded else negative
+ *         values for various possible errors
+ */
+int dht_poll(dht_async_t *dev, float *humidity, float *temperature);
+
+/*!
+ * @brief Get the timerfd to wait on, readable when dht_poll() has work
+ * @param [dev] dht_async_t - Sensor being read
+ * @return File descriptor of the timer
+ */
+int dht_fd(const dht_async_t *dev);
+//============================================================================//
+
+#endif //__DHT_ASYNC_H__
@@ -0,0 +1,165 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_bank.c
+ * @version v1.4.0 -- CHANGELOG
+ *                  | v1.0.0 - Added bank level readout of several sensors
+ *                  | v1.1.0 - Decoding through dht_decode_frame
+ *                  | v1.2.0 - Recording of capture traces
+ *                  | v1.3.0 - FIFO priority only from the start signal on
+ *                  | v1.4.0 - Metrics from the decoded frame
+ *
+ * @note    This is a library written in standard C to interface several DHT
+ *          sensors of one gpio bank on beagle bone black
+ *
+ * @sa      doc/..Technical_Reference_Manual.pdf
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <string.h>
+
+#include "dht_bank.h"
+#include "dht_decoder.h"
+#include "dht_metrics.h"
+#include "dht_trace.h"
+#include "mmio.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+// Iterations of the capture loop between two timeout checks
+static const uint32_t DHT_BANK_CHECK_EVERY  = 32;
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static void dht_bank_capture(gpio_port_t port, uint32_t edges[32][DHT_PULSES * 2 + 1], int *status) {
+    const uint32_t tpus = dht_ticks_per_us();
+    const uint32_t response_timeout = DHT_RESPONSE_TIMEOUT_US * tpus;
+    const uint32_t pulse_timeout = DHT_PULSE_TIMEOUT_US * tpus;
+
+    uint8_t seen[32] = { 0 };
+    uint32_t last[32];
+    uint32_t limit[32];
+
+    uint32_t now = dht_ticks();
+    for(int n = 0; n < 32; n++) {
+        last[n] = now;
+        limit[n] = response_timeout;
+    }
+
+    // Lines are released high, every pin starts with its response falling edge
+    uint32_t pending = port.mask;
+    uint32_t prev = port.mask;
+    uint32_t iter = 0;
+    while(pending) {
+        uint32_t lines = mmio_port_input(port);
+        now = dht_ticks();
+
+        uint32_t changed = (lines ^ prev) & pending;
+        prev = lines;
+        while(changed) {
+            int n = __builtin_ctz(changed);
+            changed &= changed - 1;
+
+            edges[n][seen[n]++] = now;
+            last[n] = now;
+            limit[n] = pulse_timeout;
+            if(seen[n] == DHT_PULSES * 2 + 1) {
+                pending &= ~(1u << n);
+                status[n] = DHT_SUCCESS;
+            }
+        }
+
+        if(++iter % DHT_BANK_CHECK_EVERY) { continue; }
+
+        // Give up on pins whose current pulse lasts too long
+        uint32_t check = pending;
+        while(check) {
+            int n = __builtin_ctz(check);
+            check &= check - 1;
+
+            if(now - last[n] >= limit[n]) {
+                pending &= ~(1u << n);
+                status[n] = DHT_ERR_TIMEOUT;
+            }
+        }
+    }
+}
+
+int dht_read_bank(int type, int base, uint32_t mask, dht_reading_t *readings, int count) {
+    // Parameters validity checks
+    if(readings == NULL || mask == 0) { return DHT_ERR_ARGUMENT; }
+    if(count < __builtin_popcount(mask)) { return DHT_ERR_ARGUMENT; }
+
+    uint32_t edges[32][DHT_PULSES * 2 + 1];
+    int status[32];
+    for(int n = 0; n < 32; n++) {
+        status[n] = DHT_ERR_TIMEOUT;
+    }
+
+    uint64_t start = dht_now_ns();
+
+    // Get the pins and set them as output together
+    gpio_port_t port;
+    if(mmio_get_port(base, mask, &port) < 0) { return DHT_ERR_GPIO; }
+    mmio_port_set_output(port);
+
+    // Start signal on every pin at once, one store per level change
+    mmio_port_set_high(port);
+    sleep_ms(DHT_START_HIGH_MS);
+
+    // Making sure process becomes faster and avoid kernel context switching.
+    // The high level sleeps, only the start signal and capture run at FIFO.
+    set_max_priority();
+    mmio_port_set_low(port);
+    block_wait_ms(DHT_START_LOW_MS);
+
+    mmio_port_set_input(port);
+    uint64_t capture = dht_now_ns();
+    dht_bank_capture(port, edges, status);
+    capture = dht_now_ns() - capture;
+
+    // Set back to default priority since critical task section is complete
+    set_default_priority();
+
+    // Decode each pin from the differences of its edge timestamps
+    const uint32_t tpus = dht_ticks_per_us();
+    int filled = 0;
+    for(int n = 0; n < 32; n++) {
+        if(!(mask & (1u << n))) { continue; }
+
+        dht_reading_t *reading = &readings[filled++];
+        memset(reading, 0, sizeof(*reading));
+        reading->num = n;
+        reading->status = status[n];
+        if(status[n] < 0) {
+            dht_metrics_record(base, n, status[n], dht_now_ns() - start, capture, DHT_CAPTURE_TIME, NULL);
+            continue;
+        }
+
+        uint32_t pulses[DHT_PULSES * 2];
+        for(int i = 0; i < DHT_PULSES * 2; i++) {
+            pulses[i] = (edges[n][i + 1] - edges[n][i]) / tpus;
+        }
+
+        dht_frame_t frame;
+        reading->status = dht_decode_frame(pulses, DHT_PULSES * 2, 1, &frame);
+        if(reading->status == DHT_SUCCESS) {
+            reading->status = dht_convert(type, frame.data, &reading->humidity, &reading->temperature);
+        }
+        dht_trace_record(type, base, n, DHT_CAPTURE_TIME, reading->status, pulses, DHT_PULSES * 2);
+        dht_metrics_record(base, n, reading->status, dht_now_ns() - start, capture, DHT_CAPTURE_TIME, &frame);
+    }
+
+    return filled;
+}
+//============================================================================//
@@ -0,0 +1,60 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_bank.h
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added bank level readout of several sensors
+ *
+ * @note    All sensors of a gpio bank are triggered together and captured in
+ *          one window, sampling DATAIN once per iteration and splitting the
+ *          edges per pin
+ *
+ * @sa      doc/..Technical_Reference_Manual.pdf
+ *
+ */
+
+#ifndef __DHT_BANK_H__
+#define __DHT_BANK_H__
+
+//===== INCLUDE ==============================================================//
+#include "dht_common.h"
+//============================================================================//
+
+//===== TYPES, CONSTANTS AND VARIABLES =======================================//
+typedef struct DHT_READING {
+    int num;                    // GPIO number of the sensor
+    int status;                 // dht_err_e result of this sensor
+    float humidity;
+    float temperature;
+} dht_reading_t;
+//============================================================================//
+
+//===== FUNCTION DECLARATION =================================================//
+/*!
+ * @brief This function reads every DHT sensor connected to the pins of a gpio
+ *        bank in a single capture window
+ * @param [type] int - Type of the sensors i.e. DHT11, DHT22 etc.
+ * @param [base] int - Gpio base where the sensors are connected (0..3)
+ * @param [mask] uint32_t - Pins with a sensor (bit n for GPIO number n)
+ * @param [readings] dht_reading_t - Output, one entry per pin of the mask in
+ *                                   ascending pin order
+ * @param [count] int - Number of entries available in readings
+ * @return Number of readings filled if success else negative values for
+ *         errors affecting every pin
+ *
+ * @note Edges are always time-stamped, the capture mode of dht_read does not
+ *       apply here
+ */
+int dht_read_bank(int type, int base, uint32_t mask, dht_reading_t *readings, int count);
+//============================================================================//
+
+#endif //__DHT_BANK_H__
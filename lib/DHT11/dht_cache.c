@@ -0,0 +1,184 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_cache.c
+ * @version v1.0.1 -- CHANGELOG
+ *                  | v1.0.0 - Added rate limited reading cache
+ *                  | v1.0.1 - Kept retries the minimum interval apart
+ *
+ * @note    This is a library written in standard C to interface DHT11 sensor
+ *          on beagle bone black
+ *
+ * @sa      doc/DHT11_Technical_Reference.pdf
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+#include "dht_cache.h"
+#include "dht11.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+#define DHT_CACHE_DEFAULT_CFG {  \
+    .dht11_interval_ms = 1000,  \
+    .dht22_interval_ms = 2000,  \
+    .retries = 2,               \
+    .backoff_ms = 250,          \
+    .backoff_max_ms = 1000      \
+}
+
+static const dht_cache_cfg_t DHT_CACHE_DEFAULTS = DHT_CACHE_DEFAULT_CFG;
+
+typedef struct DHT_CACHE_ENTRY {
+    int used;
+    int type;
+    int base;
+    int num;
+
+    int busy;                               // Physical read in progress
+    int status;                             // Result of the latest read
+    int good;                               // Values below are valid
+    uint64_t read_ms;                       // Start of the latest read
+    uint64_t good_ms;                       // Time of the last good read
+    float humidity;
+    float temperature;
+} dht_cache_entry_t;
+
+static pthread_mutex_t cache_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t cache_done = PTHREAD_COND_INITIALIZER;
+static dht_cache_entry_t cache[DHT_CACHE_ENTRIES];
+static dht_cache_cfg_t cache_cfg = DHT_CACHE_DEFAULT_CFG;
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static uint64_t dht_cache_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static dht_cache_entry_t *dht_cache_find(int type, int base, int num) {
+    dht_cache_entry_t *free_entry = NULL;
+    for(int i = 0; i < DHT_CACHE_ENTRIES; i++) {
+        dht_cache_entry_t *entry = &cache[i];
+        if(!entry->used) {
+            if(free_entry == NULL) { free_entry = entry; }
+            continue;
+        }
+        if(entry->type == type && entry->base == base && entry->num == num) {
+            return entry;
+        }
+    }
+
+    if(free_entry != NULL) {
+        memset(free_entry, 0, sizeof(*free_entry));
+        free_entry->used = 1;
+        free_entry->type = type;
+        free_entry->base = base;
+        free_entry->num = num;
+        free_entry->status = DHT_ERR_TIMEOUT;
+    }
+    return free_entry;
+}
+
+static int dht_cache_result(const dht_cache_entry_t *entry, uint64_t now, dht_cached_t *reading) {
+    memset(reading, 0, sizeof(*reading));
+    reading->status = entry->status;
+    if(!entry->good) { return entry->status; }
+
+    reading->humidity = entry->humidity;
+    reading->temperature = entry->temperature;
+    reading->age_ms = (uint32_t) (now - entry->good_ms);
+    return DHT_SUCCESS;
+}
+
+void dht_cache_config(const dht_cache_cfg_t *cfg) {
+    pthread_mutex_lock(&cache_lock);
+    cache_cfg = cfg != NULL ? *cfg : DHT_CACHE_DEFAULTS;
+    pthread_mutex_unlock(&cache_lock);
+}
+
+int dht_cache_read(int type, int base, int num, dht_cached_t *reading) {
+    if(reading == NULL) { return DHT_ERR_ARGUMENT; }
+
+    pthread_mutex_lock(&cache_lock);
+    dht_cache_entry_t *entry = dht_cache_find(type, base, num);
+    if(entry == NULL) {
+        pthread_mutex_unlock(&cache_lock);
+        return DHT_ERR_ARGUMENT;
+    }
+
+    // Join a read already in progress instead of starting another one
+    if(entry->busy) {
+        while(entry->busy) {
+            pthread_cond_wait(&cache_done, &cache_lock);
+        }
+        int result = dht_cache_result(entry, dht_cache_now_ms(), reading);
+        pthread_mutex_unlock(&cache_lock);
+        return result;
+    }
+
+    // Serve from the cache while the sensor must rest, failed reads included
+    uint64_t now = dht_cache_now_ms();
+    uint32_t interval = type == DHT22 ? cache_cfg.dht22_interval_ms : cache_cfg.dht11_interval_ms;
+    if(entry->read_ms != 0 && now - entry->read_ms < interval) {
+        int result = dht_cache_result(entry, now, reading);
+        pthread_mutex_unlock(&cache_lock);
+        return result;
+    }
+
+    dht_cache_cfg_t cfg = cache_cfg;
+    entry->busy = 1;
+    entry->read_ms = now;
+    pthread_mutex_unlock(&cache_lock);
+
+    // Physical read with bounded exponential backoff between attempts. A
+    // retry is a read as well, it starts no sooner than the interval after
+    // the previous attempt started.
+    float humidity = 0.0f;
+    float temperature = 0.0f;
+    uint32_t backoff = cfg.backoff_ms;
+    uint64_t started = now;
+    int result = dht_read(type, base, num, &humidity, &temperature);
+    for(uint32_t attempt = 0; attempt < cfg.retries; attempt++) {
+        if(result == DHT_SUCCESS || result == DHT_ERR_ARGUMENT || result == DHT_ERR_GPIO) { break; }
+
+        uint64_t elapsed = dht_cache_now_ms() - started;
+        uint64_t wait = elapsed < interval ? interval - elapsed : 0;
+        sleep_ms(wait > backoff ? (uint32_t) wait : backoff);
+        backoff = backoff * 2 > cfg.backoff_max_ms ? cfg.backoff_max_ms : backoff * 2;
+        started = dht_cache_now_ms();
+        result = dht_read(type, base, num, &humidity, &temperature);
+    }
+
+    pthread_mutex_lock(&cache_lock);
+    now = dht_cache_now_ms();
+    entry->busy = 0;
+    entry->status = result;
+    entry->read_ms = now;
+    if(result == DHT_SUCCESS) {
+        entry->good = 1;
+        entry->good_ms = now;
+        entry->humidity = humidity;
+        entry->temperature = temperature;
+    }
+    pthread_cond_broadcast(&cache_done);
+
+    result = dht_cache_result(entry, now, reading);
+    pthread_mutex_unlock(&cache_lock);
+    return result;
+}
+//============================================================================//
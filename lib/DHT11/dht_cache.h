@@ -0,0 +1,77 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_cache.h
+ * @version v1.0.1 -- CHANGELOG
+ *                  | v1.0.0 - Added rate limited reading cache
+ *                  | v1.0.1 - Kept retries the minimum interval apart
+ *
+ * @note    Caching layer over dht_read keyed by (type, base, num). Sensors are
+ *          read at most once per minimum interval, concurrent callers share
+ *          one physical read, failed reads are retried with a bounded backoff
+ *          and the last good value is returned with its age when they fail.
+ *
+ * @sa      doc/DHT11_Technical_Reference.pdf
+ *
+ */
+
+#ifndef __DHT_CACHE_H__
+#define __DHT_CACHE_H__
+
+//===== INCLUDE ==============================================================//
+#include "dht_common.h"
+//============================================================================//
+
+//===== TYPES, CONSTANTS AND VARIABLES =======================================//
+#define DHT_CACHE_ENTRIES       16
+
+typedef struct DHT_CACHE_CFG {
+    uint32_t dht11_interval_ms;             // Minimum time between DHT11 reads
+    uint32_t dht22_interval_ms;             // Minimum time between DHT22 reads
+    uint32_t retries;                       // Extra attempts after a failure
+    uint32_t backoff_ms;                    // Wait before the first retry, at
+                                            // least the rest of the interval
+    uint32_t backoff_max_ms;                // Cap of the doubling backoff
+} dht_cache_cfg_t;
+
+typedef struct DHT_CACHED {
+    float humidity;                         // Last good humidity
+    float temperature;                      // Last good temperature
+    uint32_t age_ms;                        // Age of the values
+    int status;                             // Result of the latest physical read
+} dht_cached_t;
+//============================================================================//
+
+//===== FUNCTION DECLARATION =================================================//
+/*!
+ * @brief Replaces the intervals and retry policy of the cache. Defaults are
+ *        1 s for DHT11, 2 s for DHT22 and 2 retries from 250 ms up to 1 s.
+ * @param [cfg] dht_cache_cfg_t - New configuration, NULL restores defaults
+ * @return None
+ */
+void dht_cache_config(const dht_cache_cfg_t *cfg);
+
+/*!
+ * @brief Get the reading of a sensor, reading it only when the cached value
+ *        is older than the minimum interval
+ * @param [type] int - Type of sensor i.e. DHT11, DHT22 etc.
+ * @param [base] int - Gpio base where the sensor is connected (0..3)
+ * @param [num] int - GPIO pin number where the sensor is connected (0..31)
+ * @param [reading] dht_cached_t - Output of the values, their age and the
+ *                                 status of the latest physical read
+ * @return 0 if the values are valid (fresh or last good) else the error of
+ *         the latest read when the sensor never returned a good value
+ */
+int dht_cache_read(int type, int base, int num, dht_cached_t *reading);
+//============================================================================//
+
+#endif //__DHT_CACHE_H__
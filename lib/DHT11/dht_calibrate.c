@@ -0,0 +1,207 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_calibrate.c
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added loop speed calibration
+ *
+ * @note    This is a library written in standard C to interface DHT11 sensor
+ *          on beagle bone black
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#define _GNU_SOURCE
+#include <elf.h>
+#include <link.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dht_calibrate.h"
+#include "dht_capture.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+#define DHT_BUILD_ID_MAX        32
+
+static const uint32_t DHT_CALIBRATION_MAGIC = 0x4C414344;  // "DCAL"
+static const uint32_t DHT_CALIBRATION_VERSION = 1;
+
+// Each round polls the idle line this many times, the fastest round counts
+static const uint32_t DHT_CALIBRATION_LOOPS = 200000;
+static const int DHT_CALIBRATION_ROUNDS = 5;
+static const int DHT_CALIBRATION_ATTEMPTS = 20;
+
+typedef struct DHT_CALIBRATION {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t cpu_khz;                       // Maximum CPU frequency
+    uint32_t loops_per_ms;
+    uint32_t build_id_len;
+    uint8_t build_id[DHT_BUILD_ID_MAX];
+    uint32_t check;
+} dht_calibration_t;
+
+static uint32_t loops_per_ms = 0;
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static uint32_t dht_calibration_check(const dht_calibration_t *cal) {
+    // FNV-1a of everything but the check itself
+    const uint8_t *bytes = (const uint8_t *) cal;
+    uint32_t hash = 2166136261u;
+    for(size_t i = 0; i < offsetof(dht_calibration_t, check); i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static uint32_t dht_cpu_khz(void) {
+    // Busy loops run the governor up to its maximum
+    static const char *paths[] = {
+        "/sys/devices/system/cpu/cpu0/cpufreq/scaling_max_freq",
+        "/sys/devices/system/cpu/cpu0/cpufreq/cpuinfo_max_freq",
+    };
+
+    for(size_t i = 0; i < sizeof(paths) / sizeof(paths[0]); i++) {
+        FILE *file = fopen(paths[i], "r");
+        if(file == NULL) { continue; }
+
+        unsigned int khz = 0;
+        int found = fscanf(file, "%u", &khz) == 1;
+        fclose(file);
+        if(found) { return khz; }
+    }
+    return 0;
+}
+
+static int dht_build_id_note(struct dl_phdr_info *info, size_t size, void *data) {
+    dht_calibration_t *cal = (dht_calibration_t *) data;
+
+    // The first object is the program itself
+    for(int i = 0; i < info->dlpi_phnum; i++) {
+        const ElfW(Phdr) *phdr = &info->dlpi_phdr[i];
+        if(phdr->p_type != PT_NOTE) { continue; }
+
+        const uint8_t *note = (const uint8_t *) (info->dlpi_addr + phdr->p_vaddr);
+        const uint8_t *end = note + phdr->p_memsz;
+        while(note + sizeof(ElfW(Nhdr)) <= end) {
+            const ElfW(Nhdr) *nhdr = (const ElfW(Nhdr) *) note;
+            const uint8_t *name = note + sizeof(*nhdr);
+            const uint8_t *desc = name + ((nhdr->n_namesz + 3) & ~3u);
+            if(nhdr->n_type == NT_GNU_BUILD_ID && nhdr->n_namesz == 4 && memcmp(name, "GNU", 4) == 0) {
+                cal->build_id_len = nhdr->n_descsz > DHT_BUILD_ID_MAX ? DHT_BUILD_ID_MAX : nhdr->n_descsz;
+                memcpy(cal->build_id, desc, cal->build_id_len);
+                return 1;
+            }
+            note = desc + ((nhdr->n_descsz + 3) & ~3u);
+        }
+    }
+    return 1;
+}
+
+static void dht_calibration_key(dht_calibration_t *cal) {
+    memset(cal, 0, sizeof(*cal));
+    cal->magic = DHT_CALIBRATION_MAGIC;
+    cal->version = DHT_CALIBRATION_VERSION;
+    cal->cpu_khz = dht_cpu_khz();
+    dl_iterate_phdr(dht_build_id_note, cal);
+
+    // Without a build ID the library build time tells builds apart
+    if(cal->build_id_len == 0) {
+        const char *stamp = __DATE__ " " __TIME__;
+        cal->build_id_len = strlen(stamp);
+        memcpy(cal->build_id, stamp, cal->build_id_len);
+    }
+}
+
+static int dht_calibration_load(const char *path, const dht_calibration_t *key) {
+    FILE *file = fopen(path, "rb");
+    if(file == NULL) { return 0; }
+
+    dht_calibration_t cal;
+    int found = fread(&cal, sizeof(cal), 1, file) == 1;
+    fclose(file);
+
+    found = found && cal.check == dht_calibration_check(&cal) && cal.loops_per_ms != 0 &&
+        memcmp(&cal, key, offsetof(dht_calibration_t, loops_per_ms)) == 0 &&
+        cal.build_id_len == key->build_id_len &&
+        memcmp(cal.build_id, key->build_id, sizeof(cal.build_id)) == 0;
+    if(found) {
+        __atomic_store_n(&loops_per_ms, cal.loops_per_ms, __ATOMIC_RELAXED);
+    }
+    return found;
+}
+
+static void dht_calibration_save(const char *path, dht_calibration_t *cal) {
+    // Written aside and renamed, a crash never leaves a partial cache
+    char tmp[256];
+    if(snprintf(tmp, sizeof(tmp), "%s.tmp", path) >= (int) sizeof(tmp)) { return; }
+
+    FILE *file = fopen(tmp, "wb");
+    if(file == NULL) { return; }
+
+    cal->check = dht_calibration_check(cal);
+    int written = fwrite(cal, sizeof(*cal), 1, file) == 1;
+    written = fclose(file) == 0 && written;
+    if(!written || rename(tmp, path) != 0) {
+        remove(tmp);
+    }
+}
+
+static uint32_t dht_calibration_measure(gpio_t pin) {
+    uint32_t best = 0;
+    int rounds = 0;
+
+    set_max_priority();
+    for(int attempt = 0; attempt < DHT_CALIBRATION_ATTEMPTS && rounds < DHT_CALIBRATION_ROUNDS; attempt++) {
+        uint32_t level = mmio_input(pin) != 0;
+        uint64_t start = dht_now_ns();
+        uint32_t loops = dht_count_level(pin, level, DHT_CALIBRATION_LOOPS);
+        uint64_t ns = dht_now_ns() - start;
+
+        // The line moved, the round did not run the whole loop
+        if(loops < DHT_CALIBRATION_LOOPS || ns == 0) { continue; }
+
+        uint64_t rate = (uint64_t) loops * 1000000 / ns;
+        if(rate > best) { best = rate > UINT32_MAX ? UINT32_MAX : (uint32_t) rate; }
+        rounds++;
+    }
+    set_default_priority();
+
+    return rounds == DHT_CALIBRATION_ROUNDS ? best : 0;
+}
+
+int dht_calibrate(int base, int num, const char *cache) {
+    dht_calibration_t cal;
+    dht_calibration_key(&cal);
+    if(cache != NULL && dht_calibration_load(cache, &cal)) { return DHT_SUCCESS; }
+
+    gpio_t pin;
+    if(mmio_get_gpio(base, num, &pin) < 0) { return DHT_ERR_GPIO; }
+    mmio_set_input(pin);
+
+    cal.loops_per_ms = dht_calibration_measure(pin);
+    if(cal.loops_per_ms == 0) { return DHT_ERR_TIMEOUT; }
+
+    __atomic_store_n(&loops_per_ms, cal.loops_per_ms, __ATOMIC_RELAXED);
+    if(cache != NULL) {
+        dht_calibration_save(cache, &cal);
+    }
+    return DHT_SUCCESS;
+}
+
+uint32_t dht_loops_per_ms(void) {
+    return __atomic_load_n(&loops_per_ms, __ATOMIC_RELAXED);
+}
+//============================================================================//
@@ -0,0 +1,55 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_calibrate.h
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added loop speed calibration
+ *
+ * @note    DHT_CAPTURE_COUNT measures pulses in iterations of the polling
+ *          loop, whose speed depends on compiler flags and CPU frequency. The
+ *          calibration times that same loop on the idle sensor line, then the
+ *          count mode timeouts and decode unit are derived from it.
+ *
+ *          The result is kept in a small cache file keyed by the maximum CPU
+ *          frequency and the GNU build ID of the program, so later starts
+ *          load it instead of measuring again.
+ *
+ */
+
+#ifndef __DHT_CALIBRATE_H__
+#define __DHT_CALIBRATE_H__
+
+//===== INCLUDE ==============================================================//
+#include "dht_common.h"
+//============================================================================//
+
+//===== FUNCTION DECLARATION =================================================//
+/*!
+ * @brief Loads the loop speed from the cache or measures it on a sensor pin,
+ *        which must be idle (pulled up) while measuring
+ * @param [base] int - Gpio base where the sensor is connected (0..3)
+ * @param [num] int - GPIO pin number where the sensor is connected (0..31)
+ * @param [cache] char - Cache file, NULL to always measure
+ * @return 0 if success else negative values for various possible errors
+ */
+int dht_calibrate(int base, int num, const char *cache);
+
+/*!
+ * @brief Get the calibrated loop speed
+ * @param None
+ * @return [uint32_t] Polling loop iterations per millisecond, 0 if not
+ *         calibrated
+ */
+uint32_t dht_loops_per_ms(void);
+//============================================================================//
+
+#endif //__DHT_CALIBRATE_H__
@@ -0,0 +1,113 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_capture.c
+ * @version v1.5.0 -- CHANGELOG
+ *                  | v1.0.0 - Moved pulse capture out of dht_read
+ *                  | v1.1.0 - Capture until the line rests, robust decoder
+ *                  | v1.2.0 - Count mode timeouts and unit from the calibration
+ *                  | v1.3.0 - Capture runs on the timed bit-bang engine
+ *                  | v1.4.0 - Sampling mode captures through dht_sample
+ *                  | v1.5.0 - Decoded frame returned for the metrics
+ *
+ * @note    This is a library written in standard C to interface DHT11 sensor
+ *          on beagle bone black
+ *
+ * @sa      doc/DHT11_Technical_Reference.pdf
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <stdio.h>
+#include <string.h>
+
+#include "dht_calibrate.h"
+#include "dht_capture.h"
+#include "dht_decoder.h"
+#include "dht_sample.h"
+#include "dht11.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+static const uint32_t DHT_MAXCOUNT  = 32000;
+
+// Pulse measurement used by the readers
+static dht_capture_e capture_mode = DHT_CAPTURE_TIME;
+
+// Response of the sensor once the start signal released the line: wait for
+// its low level, then every level until the line rests after the frame
+static const dht_pulse_step_t DHT_PULSE_STEPS[] = {
+    { .op = DHT_PULSE_WAIT, .level = 0, .us = DHT_RESPONSE_TIMEOUT_US },
+    { .op = DHT_PULSE_CAPTURE, .level = 0, .count = DHT_RUNS_MAX, .us = DHT_PULSE_TIMEOUT_US }
+};
+
+static const dht_pulse_proto_t DHT_PULSE_PROTO = {
+    .steps = DHT_PULSE_STEPS,
+    .count = sizeof(DHT_PULSE_STEPS) / sizeof(DHT_PULSE_STEPS[0])
+};
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static uint32_t dht_loops_for(uint32_t us, uint32_t loops_per_ms) {
+    uint64_t loops = (uint64_t) us * loops_per_ms / 1000;
+    return loops == 0 ? 1 : loops > UINT32_MAX ? UINT32_MAX : (uint32_t) loops;
+}
+
+void dht_set_capture(dht_capture_e mode) {
+    capture_mode = mode;
+}
+
+dht_capture_e dht_capture_mode(void) {
+    return capture_mode;
+}
+
+int dht_capture(gpio_t pin, dht_capture_e mode, uint32_t *pulses, int *count) {
+    if(mode == DHT_CAPTURE_SAMPLE) { return dht_sample_capture(pin, pulses, count); }
+
+    memset(pulses, 0, DHT_RUNS_MAX * sizeof(uint32_t));
+    *count = 0;
+
+    // Counts follow the calibrated loop speed. Without one the pulse timeout
+    // is the fixed count, the response gets the same count per microsecond.
+    uint32_t loops_per_ms = 0;
+    if(mode == DHT_CAPTURE_COUNT) {
+        loops_per_ms = dht_loops_per_ms();
+        if(loops_per_ms == 0) { loops_per_ms = DHT_MAXCOUNT * 1000 / DHT_PULSE_TIMEOUT_US; }
+    }
+
+    dht_pulse_buf_t buf = { .widths = pulses, .max = DHT_RUNS_MAX };
+    int result = dht_pulse_run(&pin, &DHT_PULSE_PROTO, &buf, loops_per_ms);
+    *count = buf.count;
+
+    if(result != DHT_SUCCESS) { return DHT_ERR_TIMEOUT; }
+    return buf.count >= (int) DHT_PULSES * 2 ? DHT_SUCCESS : DHT_ERR_TIMEOUT;
+}
+
+int dht_decode(int type, dht_capture_e mode, const uint32_t *pulses, int count, dht_frame_t *frame,
+    float *humidity, float *temperature) {
+    // Timestamps are in microseconds, loop counts in calibrated loops per
+    // microsecond or, without calibration, judged relative to each other
+    uint32_t unit = 1;
+    if(mode == DHT_CAPTURE_COUNT) {
+        unit = dht_loops_per_ms() == 0 ? 0 : dht_loops_for(1, dht_loops_per_ms());
+    }
+
+    int result = dht_decode_frame(pulses, count, unit, frame);
+
+    // Debugging only
+    // fprintf(stdout, "Data: 0x%x 0x%x 0x%x 0x%x 0x%x confidence %.2f\n", frame->data[0], frame->data[1],
+    //     frame->data[2], frame->data[3], frame->data[4], frame->confidence);
+
+    if(result != DHT_SUCCESS) { return result; }
+    return dht_convert(type, frame->data, humidity, temperature);
+}
+//============================================================================//
@@ -0,0 +1,73 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_capture.h
+ * @version v1.5.0 -- CHANGELOG
+ *                  | v1.0.0 - Moved pulse capture out of dht_read
+ *                  | v1.1.0 - Capture until the line rests, robust decoder
+ *                  | v1.2.0 - Loop counting shared with the calibration
+ *                  | v1.3.0 - Capture runs on the timed bit-bang engine
+ *                  | v1.4.0 - Sampling mode captures through dht_sample
+ *                  | v1.5.0 - Decoded frame returned for the metrics
+ *
+ * @note    Capture and decode steps shared by the DHT readers of this library.
+ *          Internal to the library, applications use dht11.h.
+ *
+ * @sa      doc/DHT11_Technical_Reference.pdf
+ *
+ */
+
+#ifndef __DHT_CAPTURE_H__
+#define __DHT_CAPTURE_H__
+
+//===== INCLUDE ==============================================================//
+#include "dht_common.h"
+#include "dht_decoder.h"
+#include "dht_pulse.h"
+#include "mmio.h"
+//============================================================================//
+
+//===== FUNCTION DECLARATION =================================================//
+/*!
+ * @brief Get the capture mode selected with dht_set_capture
+ * @param None
+ * @return [dht_capture_e] Current capture mode
+ */
+dht_capture_e dht_capture_mode(void);
+
+/*!
+ * @brief Busy-waits on an input pin after the start signal and measures the
+ *        widths of the response levels until the line rests
+ * @param [pin] gpio_t - Pin of the sensor, already set as input
+ * @param [mode] dht_capture_e - Loop counts, timestamps or sampled words
+ * @param [pulses] uint32_t - Output of DHT_RUNS_MAX pulse widths
+ * @param [count] int - Output of the number of widths measured
+ * @return 0 if success else DHT_ERR_TIMEOUT if fewer than DHT_PULSES * 2
+ */
+int dht_capture(gpio_t pin, dht_capture_e mode, uint32_t *pulses, int *count);
+
+/*!
+ * @brief Interprets captured pulses, verifies and converts the frame
+ * @param [type] int - Type of sensor i.e. DHT11, DHT22 etc.
+ * @param [mode] dht_capture_e - Mode the pulses were captured with
+ * @param [pulses] uint32_t - Pulse widths from dht_capture
+ * @param [count] int - Number of pulse widths
+ * @param [frame] dht_frame_t - Output of the decoded frame
+ * @param [humidity] float - Output of humidity value
+ * @param [temperature] float - Output of temperature value
+ * @return 0 if success else DHT_ERR_CHECKSUM or DHT_ERR_TIMEOUT
+ */
+int dht_decode(int type, dht_capture_e mode, const uint32_t *pulses, int count, dht_frame_t *frame,
+    float *humidity, float *temperature);
+//============================================================================//
+
+#endif //__DHT_CAPTURE_H__
@@ -11,8 +11,13 @@
  * @author  Syed Asad Amin
  * @date    Nov 30th, 2022
  * @file    dht_common.c
- * @version v1.0.0 -- CHANGELOG
+ * @version v1.5.0 -- CHANGELOG
  *                  | v1.0.0 - Added DHT sensor readout function
+ *                  | v1.1.0 - Added tick counter and frame conversion
+ *                  | v1.2.0 - Shared pulse decoding
+ *                  | v1.3.0 - Accounting of the time spent at FIFO priority
+ *                  | v1.4.0 - Real-time capture mode hooks
+ *                  | v1.5.0 - Trace points on priority switches
  * 
  * @note    This is a library written in standard C to interface DHT11 sensor
  *          on beagle bone black
@@ -29,9 +34,20 @@
 #include <errno.h>
 
 #include "dht_common.h"
+#include "dht_rt.h"
+#include "trace.h"
 //============================================================================//
 
 //===== CONSTANTS AND VARIABLES ==============================================//
+// Time spent at FIFO priority, the start is tracked per thread
+static __thread uint64_t fifo_since = 0;
+static uint64_t fifo_ns = 0;
+static uint64_t fifo_entries = 0;
+
+#if defined(DHT_USE_PMCCNTR) && defined(__arm__)
+// Cycle counter rate, measured against the monotonic clock on first use
+static uint32_t ticks_per_us = 0;
+#endif
 //============================================================================//
 
 //===== FUNCTION DEFINITION ==================================================//
@@ -63,16 +79,103 @@ void sleep_ms(uint32_t ms) {
 }
 
 void set_max_priority(void) {
+    // The real-time mode pins and prefaults the thread before the switch
+    TRACE_BEGIN("set_max_priority");
     struct sched_param sched;
     memset(&sched, 0, sizeof(sched));
-    sched.sched_priority = sched_get_priority_max(SCHED_FIFO);
+    sched.sched_priority = dht_rt_enter();
     sched_setscheduler(0, SCHED_FIFO, &sched);
+
+    // RLIMIT_RTTIME only starts counting again when a FIFO thread wakes up,
+    // a short sleep keeps earlier captures out of the bound
+    if(dht_rt_cpu() >= 0) {
+        struct timespec ts = { .tv_sec = 0, .tv_nsec = 50000 };
+        nanosleep(&ts, NULL);
+    }
+
+    fifo_since = dht_now_ns();
+    __atomic_fetch_add(&fifo_entries, 1, __ATOMIC_RELAXED);
+    TRACE_END("set_max_priority");
 }
 
 void set_default_priority(void) {
+    TRACE_BEGIN("set_default_priority");
     struct sched_param sched;
     memset(&sched, 0, sizeof(sched));
     sched.sched_priority = 0;
     sched_setscheduler(0, SCHED_OTHER, &sched);
+    dht_rt_leave();
+
+    // Account the time spent at FIFO priority by this thread
+    if(fifo_since != 0) {
+        __atomic_fetch_add(&fifo_ns, dht_now_ns() - fifo_since, __ATOMIC_RELAXED);
+        fifo_since = 0;
+    }
+    TRACE_END("set_default_priority");
+}
+
+uint64_t dht_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+uint64_t dht_fifo_time_ns(void) {
+    return __atomic_load_n(&fifo_ns, __ATOMIC_RELAXED);
+}
+
+uint64_t dht_fifo_entries(void) {
+    return __atomic_load_n(&fifo_entries, __ATOMIC_RELAXED);
+}
+
+uint32_t dht_ticks_per_us(void) {
+#if defined(DHT_USE_PMCCNTR) && defined(__arm__)
+    if(ticks_per_us == 0) {
+        struct timespec t0, t1;
+        clock_gettime(CLOCK_MONOTONIC_RAW, &t0);
+        uint32_t start = dht_ticks();
+        sleep_ms(10);
+        uint32_t cycles = dht_ticks() - start;
+        clock_gettime(CLOCK_MONOTONIC_RAW, &t1);
+
+        uint64_t ns = (t1.tv_sec - t0.tv_sec) * 1000000000ULL + t1.tv_nsec - t0.tv_nsec;
+        ticks_per_us = (uint32_t) ((cycles * 1000ULL + ns / 2) / ns);
+        if(ticks_per_us == 0) { ticks_per_us = 1; }
+    }
+    return ticks_per_us;
+#else
+    return 1000;
+#endif
+}
+
+void dht_decode_pulses(const uint32_t *pulses, uint32_t threshold, uint8_t data[5]) {
+    memset(data, 0, 5);
+    for(int i = 3; i < DHT_PULSES * 2; i+=2) {
+        int index = (i-3) / 16;
+        data[index] <<= 1;
+        if(pulses[i] >= threshold) {
+            data[index] |= 1;
+        }
+    }
+}
+
+int dht_convert(int type, const uint8_t data[5], float *humidity, float *temperature) {
+    uint8_t csum = (data[0] + data[1] + data[2] + data[3]) & 0xFF;
+    if(csum != data[4]) { return DHT_ERR_CHECKSUM; }
+
+    if(type == DHT11) {
+        // Integral and decimal (tenths) parts in separate bytes
+        *humidity = data[0] + data[1] / 10.0f;
+        *temperature = data[2] + data[3] / 10.0f;
+    } else if(type == DHT22) {
+        // Tenths in 16 bits, sign and magnitude for temperature
+        *humidity = (data[0] * 256 + data[1]) / 10.0f;
+        *temperature = ((data[2] & 0x7F) * 256 + data[3]) / 10.0f;
+        if(data[2] & 0x80) {
+            *temperature *= -1.0f;
+        }
+    }
+
+    return DHT_SUCCESS;
 }
 //============================================================================//
@@ -11,8 +11,17 @@
  * @author  Syed Asad Amin
  * @date    Nov 30th, 2022
  * @file    dht_common.h
- * @version v1.0.0 -- CHANGELOG
+ * @version v1.9.0 -- CHANGELOG
  *                  | v1.0.0 - Added DHT sensor readout function
+ *                  | v1.1.0 - Added tick counter and frame conversion
+ *                  | v1.2.0 - Shared pulse decoding
+ *                  | v1.3.0 - Added pending status and start signal timings
+ *                  | v1.4.0 - Accounting of the time spent at FIFO priority
+ *                  | v1.5.0 - Real-time capture mode hooks
+ *                  | v1.6.0 - Added GPIO character device capture mode
+ *                  | v1.7.0 - Added capture-then-decode sampling mode
+ *                  | v1.8.0 - Added file and format errors of traces
+ *                  | v1.9.0 - Added memory lock error of the real-time mode
  * 
  * @note    This is a library written in standard C to interface DHT11 sensor
  *          on beagle bone black
@@ -26,6 +35,7 @@
 
 //===== INCLUDE ==============================================================//
 #include <stdint.h>
+#include <time.h>
 
 //===== TYPES, CONSTANTS AND VARIABLES =======================================//
 typedef enum DHT_SENS_TYPE {
@@ -34,12 +44,39 @@ typedef enum DHT_SENS_TYPE {
 } dht_type_e;
 
 typedef enum DHT_ERR {
+    DHT_ERR_MEMORY          = -7,
+    DHT_ERR_FORMAT          = -6,
+    DHT_ERR_FILE            = -5,
     DHT_ERR_TIMEOUT         = -4,
     DHT_ERR_CHECKSUM        = -3,
     DHT_ERR_ARGUMENT        = -2,
     DHT_ERR_GPIO            = -1,
-    DHT_SUCCESS             = 0
+    DHT_SUCCESS             = 0,
+    DHT_PENDING             = 1
 } dht_err_e;
+
+typedef enum DHT_CAPTURE {
+    DHT_CAPTURE_COUNT,                      // Pulse widths in loop iterations
+    DHT_CAPTURE_TIME,                       // Pulse widths from edge timestamps
+    DHT_CAPTURE_EVENT,                      // Kernel timestamped edge events
+    DHT_CAPTURE_SAMPLE                      // Raw DATAIN words decoded afterwards
+} dht_capture_e;
+
+static const uint32_t DHT_PULSES                = 41;
+
+// Start signal, line held high then pulled low before releasing it
+static const uint32_t DHT_START_HIGH_MS         = 500;
+static const uint32_t DHT_START_LOW_MS          = 20;
+
+/*!
+ * @brief Timeouts and decode threshold of the time-stamped capture in
+ *        microseconds. Bits are 50us low followed by 26-28us high for a zero
+ *        and 70us high for a one.
+ * @sa    doc/DHT11_Technical_Reference.pdf -- Section 5. Communication Process
+ */
+static const uint32_t DHT_RESPONSE_TIMEOUT_US   = 1000;
+static const uint32_t DHT_PULSE_TIMEOUT_US      = 200;
+static const uint32_t DHT_BIT_THRESHOLD_US      = 48;
 //============================================================================//
 
 //===== FUNCTION DECLARATION =================================================//
@@ -58,7 +95,8 @@ void block_wait_ms(uint32_t ms);
 void sleep_ms(uint32_t ms);
 
 /*!
- * @brief Sets FIFO schedular priority to max to avoid kernel context switching
+ * @brief Sets FIFO schedular priority to max to avoid kernel context switching,
+ *        with the additions of the real-time mode when enabled (dht_rt.h)
  * @param None
  * @return None
  */
@@ -70,6 +108,75 @@ void set_max_priority(void);
  * @return None
  */
 void set_default_priority(void);
+
+/*!
+ * @brief Get the monotonic time
+ * @param None
+ * @return [uint64_t] CLOCK_MONOTONIC time in nanoseconds
+ */
+uint64_t dht_now_ns(void);
+
+/*!
+ * @brief Get the total time spent between set_max_priority and
+ *        set_default_priority, summed over all threads
+ * @param None
+ * @return [uint64_t] Time at FIFO priority in nanoseconds
+ */
+uint64_t dht_fifo_time_ns(void);
+
+/*!
+ * @brief Get the number of set_max_priority calls
+ * @param None
+ * @return [uint64_t] Number of switches to FIFO priority
+ */
+uint64_t dht_fifo_entries(void);
+
+/*!
+ * @brief Get the resolution of the tick counter used to timestamp edges
+ * @param None
+ * @return [uint32_t] Ticks per microsecond
+ */
+uint32_t dht_ticks_per_us(void);
+
+/*!
+ * @brief Free running 32 bit tick counter, differences of two readings are
+ *        valid across wrap around. Uses the ARM cycle counter when built with
+ *        DHT_USE_PMCCNTR (user access must be enabled by a kernel module),
+ *        otherwise CLOCK_MONOTONIC_RAW in nanoseconds.
+ * @param None
+ * @return [uint32_t] Current tick count
+ */
+static inline uint32_t dht_ticks(void) {
+#if defined(DHT_USE_PMCCNTR) && defined(__arm__)
+    uint32_t cycles;
+    __asm__ volatile("mrc p15, 0, %0, c9, c13, 0" : "=r"(cycles));
+    return cycles;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+    return (uint32_t) ts.tv_sec * 1000000000u + (uint32_t) ts.tv_nsec;
+#endif
+}
+
+/*!
+ * @brief Interprets captured pulses as the 40 data bits. Pulses alternate low
+ *        and high starting with the 80us response low pulse.
+ * @param [pulses] uint32_t - DHT_PULSES * 2 pulse widths
+ * @param [threshold] uint32_t - High pulses at least this wide are ones
+ * @param [data] uint8_t - Output of the 5 byte frame
+ * @return None
+ */
+void dht_decode_pulses(const uint32_t *pulses, uint32_t threshold, uint8_t data[5]);
+
+/*!
+ * @brief Verifies the checksum of a received frame and converts it
+ * @param [type] int - Type of sensor i.e. DHT11, DHT22 etc.
+ * @param [data] uint8_t - Received 5 byte frame
+ * @param [humidity] float - Output of humidity value
+ * @param [temperature] float - Output of temperature value
+ * @return 0 if success else DHT_ERR_CHECKSUM
+ */
+int dht_convert(int type, const uint8_t data[5], float *humidity, float *temperature);
 //============================================================================//
 
 #endif // __DHT_COMMON_H__
@@ -0,0 +1,220 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_decoder.c
+ * @version v1.2.0 -- CHANGELOG
+ *                  | v1.0.0 - Added robust frame decoder
+ *                  | v1.1.0 - Spikes up to a few microseconds are glitches
+ *                  | v1.2.0 - Frame carries its aligned bit widths
+ *
+ * @note    This is a library written in standard C to interface DHT11 sensor
+ *          on beagle bone black
+ *
+ * @sa      doc/DHT11_Technical_Reference.pdf
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <string.h>
+
+#include "dht_decoder.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+#define DHT_BITS                DHT_FRAME_BITS
+#define DHT_FRAME_RUNS          (2 + DHT_BITS * 2)
+
+// Levels last at least 26us, shorter spikes are noise. Kernel timestamped
+// edges resolve spikes that polling loops merge into one level.
+static const uint32_t DHT_GLITCH_US     = 5;
+
+// Preamble levels are 80us against 50us for the low level of a bit
+static const float DHT_PREAMBLE_RATIO   = 1.2f;
+
+// Ones are 70us against 26-28us for zeros, closer clusters are one value
+static const float DHT_CLUSTER_RATIO    = 1.6f;
+
+// Distance from the threshold at which a bit is fully trusted
+static const float DHT_MARGIN_RATIO     = 0.45f;
+
+// Confidence above which the expected alignment is taken without a search
+static const float DHT_CONFIDENT        = 0.5f;
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static void dht_sort(uint32_t *values, int count) {
+    for(int i = 1; i < count; i++) {
+        uint32_t value = values[i];
+        int j = i;
+        for(; j > 0 && values[j - 1] > value; j--) {
+            values[j] = values[j - 1];
+        }
+        values[j] = value;
+    }
+}
+
+static int dht_merge_glitches(const uint32_t *widths, int count, uint32_t glitch,
+    uint32_t *runs, uint8_t *levels, uint16_t *glitches) {
+    int n = 0;
+    int level = 0;
+    for(int i = 0; i < count; i++, level ^= 1) {
+        if(widths[i] >= glitch) {
+            runs[n] = widths[i];
+            levels[n] = (uint8_t) level;
+            n++;
+            continue;
+        }
+
+        // The level flipped back at once, both edges are dropped
+        (*glitches)++;
+        if(n > 0 && i + 1 < count) {
+            runs[n - 1] += widths[i] + widths[i + 1];
+            i++;
+            level ^= 1;
+        }
+    }
+    return n;
+}
+
+static int dht_checksum_ok(const uint8_t data[5]) {
+    uint8_t csum = (data[0] + data[1] + data[2] + data[3]) & 0xFF;
+    return csum == data[4] && (data[0] | data[1] | data[2] | data[3]) != 0;
+}
+
+static int dht_decode_at(const uint32_t *runs, int at, int strict, dht_frame_t *frame) {
+    uint32_t lows[DHT_BITS];
+    uint32_t highs[DHT_BITS];
+    for(int b = 0; b < DHT_BITS; b++) {
+        lows[b] = runs[at + 2 + 2 * b];
+        highs[b] = runs[at + 3 + 2 * b];
+    }
+    memcpy(frame->lows, lows, sizeof(lows));
+    memcpy(frame->highs, highs, sizeof(highs));
+
+    // Bit low levels are all alike, their median is the reference width
+    dht_sort(lows, DHT_BITS);
+    uint32_t reference = (lows[DHT_BITS / 2 - 1] + lows[DHT_BITS / 2]) / 2;
+    if(strict && (runs[at] < reference * DHT_PREAMBLE_RATIO || runs[at + 1] < reference * DHT_PREAMBLE_RATIO)) {
+        return 0;
+    }
+
+    // Split the sorted high widths where the two clusters are furthest apart
+    // relative to their sizes (largest between-class variance)
+    uint32_t sorted[DHT_BITS];
+    memcpy(sorted, highs, sizeof(sorted));
+    dht_sort(sorted, DHT_BITS);
+
+    uint64_t total = 0;
+    for(int b = 0; b < DHT_BITS; b++) {
+        total += sorted[b];
+    }
+
+    int split = 0;
+    float best = 0.0f;
+    float mean0 = 0.0f;
+    float mean1 = 0.0f;
+    uint64_t sum = 0;
+    for(int k = 1; k < DHT_BITS; k++) {
+        sum += sorted[k - 1];
+        float m0 = (float) sum / k;
+        float m1 = (float) (total - sum) / (DHT_BITS - k);
+        float score = (float) k * (DHT_BITS - k) * (m1 - m0) * (m1 - m0);
+        if(score > best) {
+            best = score;
+            split = k;
+            mean0 = m0;
+            mean1 = m1;
+        }
+    }
+
+    // Clusters that do not straddle the low level mean every bit is the same,
+    // the low level then separates them as it lies between 28us and 70us
+    uint32_t threshold = reference;
+    if(split != 0 && mean1 >= mean0 * DHT_CLUSTER_RATIO && mean0 < reference && mean1 > reference) {
+        threshold = (sorted[split - 1] + sorted[split] + 1) / 2;
+    }
+    if(threshold == 0) { threshold = 1; }
+
+    memset(frame->data, 0, sizeof(frame->data));
+    float confidence = 1.0f;
+    for(int b = 0; b < DHT_BITS; b++) {
+        uint32_t high = highs[b];
+        frame->data[b / 8] <<= 1;
+        if(high >= threshold) {
+            frame->data[b / 8] |= 1;
+        }
+
+        float distance = high >= threshold ? (float) (high - threshold) : (float) (threshold - high);
+        float margin = distance / (threshold * DHT_MARGIN_RATIO);
+        if(margin < confidence) { confidence = margin; }
+    }
+
+    frame->threshold = threshold;
+    frame->offset = (uint16_t) at;
+    frame->confidence = confidence;
+    frame->status = dht_checksum_ok(frame->data) ? DHT_SUCCESS : DHT_ERR_CHECKSUM;
+    return 1;
+}
+
+int dht_decode_frame(const uint32_t *widths, int count, uint32_t ticks_per_us, dht_frame_t *frame) {
+    if(frame == NULL) { return DHT_ERR_ARGUMENT; }
+    memset(frame, 0, sizeof(*frame));
+    frame->status = DHT_ERR_TIMEOUT;
+    if(widths == NULL || count <= 0) { return frame->status; }
+    if(count > DHT_RUNS_MAX) { count = DHT_RUNS_MAX; }
+
+    // Without a unit the median width (about 50us) stands in for it
+    uint32_t glitch = ticks_per_us * DHT_GLITCH_US;
+    if(glitch == 0) {
+        uint32_t sorted[DHT_RUNS_MAX];
+        memcpy(sorted, widths, count * sizeof(uint32_t));
+        dht_sort(sorted, count);
+        glitch = sorted[count / 2] * DHT_GLITCH_US / 50;
+        if(glitch == 0) { glitch = 1; }
+    }
+
+    uint32_t runs[DHT_RUNS_MAX];
+    uint8_t levels[DHT_RUNS_MAX];
+    uint16_t glitches = 0;
+    int n = dht_merge_glitches(widths, count, glitch, runs, levels, &glitches);
+    if(n < DHT_FRAME_RUNS) {
+        frame->glitches = glitches;
+        return frame->status;
+    }
+
+    // Resynchronize on the preamble, the expected position first. A frame
+    // passing its checksum wins, then the most confident one.
+    dht_frame_t candidate;
+    int found = 0;
+    for(int strict = 1; strict >= 0 && !found; strict--) {
+        for(int at = 0; at + DHT_FRAME_RUNS <= n; at++) {
+            if(levels[at] != 0) { continue; }
+            if(!dht_decode_at(runs, at, strict, &candidate)) { continue; }
+
+            int better = !found ||
+                (candidate.status == DHT_SUCCESS && frame->status != DHT_SUCCESS) ||
+                (candidate.status == frame->status && candidate.confidence > frame->confidence);
+            if(better) {
+                *frame = candidate;
+            }
+            found = 1;
+            if(frame->status == DHT_SUCCESS && frame->confidence >= DHT_CONFIDENT) { break; }
+        }
+    }
+
+    frame->glitches = glitches;
+    if(frame->status != DHT_SUCCESS) {
+        frame->confidence *= 0.5f;
+    }
+    return frame->status;
+}
+//============================================================================//
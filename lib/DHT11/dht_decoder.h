@@ -0,0 +1,69 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_decoder.h
+ * @version v1.1.0 -- CHANGELOG
+ *                  | v1.0.0 - Added robust frame decoder
+ *                  | v1.1.0 - Frame carries its aligned bit widths
+ *
+ * @note    Decodes a frame from the widths of the line levels seen after the
+ *          start signal, without touching any GPIO:
+ *          - runs shorter than a microsecond are merged into their neighbours
+ *          - the frame is located on its 80us low / 80us high preamble, so
+ *            stray edges before it do not shift the bits
+ *          - high widths are split in two clusters, the threshold adapts to
+ *            the sensor and to the unit of the widths
+ *          - the worst bit margin is reported as the confidence
+ *
+ * @sa      doc/DHT11_Technical_Reference.pdf
+ *
+ */
+
+#ifndef __DHT_DECODER_H__
+#define __DHT_DECODER_H__
+
+//===== INCLUDE ==============================================================//
+#include "dht_common.h"
+//============================================================================//
+
+//===== TYPES, CONSTANTS AND VARIABLES =======================================//
+#define DHT_RUNS_MAX            128
+#define DHT_FRAME_BITS          40
+
+typedef struct DHT_FRAME {
+    uint8_t data[5];
+    int status;                             // dht_err_e of the frame
+    float confidence;                       // Worst bit margin, 0..1
+    uint32_t threshold;                     // High width splitting 0 and 1
+    uint16_t glitches;                      // Runs merged as glitches
+    uint16_t offset;                        // Run where the preamble starts
+    uint32_t lows[DHT_FRAME_BITS];          // Bit widths after the preamble,
+    uint32_t highs[DHT_FRAME_BITS];         // glitches merged, input unit
+} dht_frame_t;
+//============================================================================//
+
+//===== FUNCTION DECLARATION =================================================//
+/*!
+ * @brief Decodes a frame from line level widths
+ * @param [widths] uint32_t - Widths of the levels, alternating and starting
+ *        with the low level of the response
+ * @param [count] int - Number of widths, at most DHT_RUNS_MAX are used
+ * @param [ticks_per_us] uint32_t - Unit of the widths, 0 if unknown (loop
+ *        counts) to judge glitches relative to the other widths
+ * @param [frame] dht_frame_t - Output of the frame
+ * @return 0 if a frame with a valid checksum was found, DHT_ERR_CHECKSUM if
+ *         only a damaged one, DHT_ERR_TIMEOUT if too few widths
+ */
+int dht_decode_frame(const uint32_t *widths, int count, uint32_t ticks_per_us, dht_frame_t *frame);
+//============================================================================//
+
+#endif //__DHT_DECODER_H__
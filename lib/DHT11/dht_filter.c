@@ -0,0 +1,169 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_filter.c
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added streaming reading filters
+ *
+ * @note    This is a library written in standard C to interface DHT11 sensor
+ *          on beagle bone black
+ *
+ * @sa      doc/DHT11_Technical_Reference.pdf
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <math.h>
+#include <string.h>
+
+#include "dht_filter.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+// MAD to standard deviation of normally distributed readings
+static const float DHT_FILTER_MAD_SCALE = 1.4826f;
+
+// A DHT11 reads whole units, the floor keeps single steps out of the outliers
+// while the window is flat
+const dht_filter_cfg_t DHT_FILTER_HUMIDITY = {
+    .window = 7,
+    .median = 0,
+    .hampel_k = 3.0f,
+    .min_dev = 3.0f,
+    .alpha = 0.5f,
+    .max_rate = 1.0f
+};
+
+const dht_filter_cfg_t DHT_FILTER_TEMPERATURE = {
+    .window = 7,
+    .median = 0,
+    .hampel_k = 3.0f,
+    .min_dev = 1.5f,
+    .alpha = 0.5f,
+    .max_rate = 0.2f
+};
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static float dht_filter_median(const float *sorted, int count) {
+    return count % 2 ? sorted[count / 2] : (sorted[count / 2 - 1] + sorted[count / 2]) / 2.0f;
+}
+
+static void dht_filter_push(dht_filter_t *filter, float value) {
+    int window = filter->cfg.window;
+    int n = filter->count;
+
+    // The oldest reading leaves the sorted copy once the ring is full
+    if(n == window) {
+        float old = filter->ring[filter->head];
+        int i = 0;
+        while(i < n - 1 && filter->sorted[i] != old) { i++; }
+        memmove(&filter->sorted[i], &filter->sorted[i + 1], (size_t) (n - 1 - i) * sizeof(float));
+        n--;
+    }
+
+    int i = n;
+    while(i > 0 && filter->sorted[i - 1] > value) {
+        filter->sorted[i] = filter->sorted[i - 1];
+        i--;
+    }
+    filter->sorted[i] = value;
+
+    filter->ring[(filter->head + filter->count) % window] = value;
+    if(filter->count == window) {
+        filter->head = (filter->head + 1) % window;
+    } else {
+        filter->count++;
+    }
+}
+
+int dht_filter_init(dht_filter_t *filter, const dht_filter_cfg_t *cfg) {
+    if(filter == NULL || cfg == NULL) { return DHT_ERR_ARGUMENT; }
+    if(cfg->window < 0 || cfg->window > DHT_FILTER_WINDOW_MAX) { return DHT_ERR_ARGUMENT; }
+    if(cfg->alpha <= 0.0f || cfg->alpha > 1.0f || cfg->hampel_k < 0.0f || cfg->max_rate < 0.0f) {
+        return DHT_ERR_ARGUMENT;
+    }
+
+    memset(filter, 0, sizeof(*filter));
+    filter->cfg = *cfg;
+    return DHT_SUCCESS;
+}
+
+int dht_filter_stats(const dht_filter_t *filter, float *median, float *mad) {
+    if(filter == NULL || median == NULL || mad == NULL || filter->count == 0) { return DHT_ERR_ARGUMENT; }
+
+    // Deviations from the median grow outwards from the middle of the sorted
+    // window, merging both sides yields them in order without a sort
+    const float *sorted = filter->sorted;
+    const int n = filter->count;
+    const float med = dht_filter_median(sorted, n);
+    int lo = (n - 1) / 2;
+    int hi = lo + 1;
+    float below = 0.0f;
+    for(int k = 0; k <= n / 2; k++) {
+        float dl = lo >= 0 ? med - sorted[lo] : INFINITY;
+        float dh = hi < n ? sorted[hi] - med : INFINITY;
+        float d = dl <= dh ? dl : dh;
+        if(dl <= dh) { lo--; } else { hi++; }
+
+        if(k == (n - 1) / 2) { below = d; }
+        if(k == n / 2) { *mad = (below + d) / 2.0f; }
+    }
+    *median = med;
+    return DHT_SUCCESS;
+}
+
+float dht_filter_update(dht_filter_t *filter, float value, uint64_t time_ns) {
+    const dht_filter_cfg_t *cfg = &filter->cfg;
+    float pass = value;
+
+    if(cfg->window > 0) {
+        // Judged against the readings before it, so a spike can not widen
+        // the spread it is measured with
+        float median;
+        float mad;
+        if(cfg->hampel_k > 0.0f && filter->count >= 3 && dht_filter_stats(filter, &median, &mad) == DHT_SUCCESS) {
+            float limit = cfg->hampel_k * DHT_FILTER_MAD_SCALE * mad;
+            if(limit < cfg->min_dev) { limit = cfg->min_dev; }
+            if(fabsf(value - median) > limit) {
+                pass = median;
+                filter->outliers++;
+            }
+        }
+
+        // The raw reading joins the window either way, a lasting step then
+        // moves the median and stops being rejected
+        dht_filter_push(filter, value);
+        if(cfg->median) { pass = dht_filter_median(filter->sorted, filter->count); }
+    }
+
+    // The first reading starts every stage where it is
+    if(filter->time_ns == 0) {
+        filter->ema = pass;
+        filter->value = pass;
+        filter->time_ns = time_ns;
+        return pass;
+    }
+
+    filter->ema += cfg->alpha * (pass - filter->ema);
+
+    float out = filter->ema;
+    if(cfg->max_rate > 0.0f && time_ns > filter->time_ns) {
+        float step = cfg->max_rate * (float) (time_ns - filter->time_ns) / 1e9f;
+        if(out > filter->value + step) { out = filter->value + step; }
+        if(out < filter->value - step) { out = filter->value - step; }
+    }
+    filter->value = out;
+    filter->time_ns = time_ns;
+    return out;
+}
+//============================================================================//
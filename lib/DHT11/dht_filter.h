@@ -0,0 +1,97 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_filter.h
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added streaming reading filters
+ *
+ * @note    Filters one channel of good readings (humidity or temperature),
+ *          each stage can be turned off in its configuration:
+ *          - Hampel: a reading further than k scaled MADs from the median
+ *            of the window is an outlier and replaced by that median
+ *          - sliding median: the median of the window is passed on instead
+ *          - EMA: exponential moving average of what is passed on
+ *          - rate limiter: the output moves at most max_rate per second
+ *          The window is kept sorted next to its ring, so one reading costs
+ *          a bounded number of steps (at most DHT_FILTER_WINDOW_MAX) and
+ *          the state has a fixed size with nothing allocated.
+ *
+ *          A step change passes the Hampel stage once it fills half the
+ *          window, as the median then follows it.
+ *
+ */
+
+#ifndef __DHT_FILTER_H__
+#define __DHT_FILTER_H__
+
+//===== INCLUDE ==============================================================//
+#include "dht_common.h"
+//============================================================================//
+
+//===== TYPES, CONSTANTS AND VARIABLES =======================================//
+#define DHT_FILTER_WINDOW_MAX   15
+
+typedef struct DHT_FILTER_CFG {
+    int window;                             // Readings of the window, 0 off
+    int median;                             // Pass the window median on
+    float hampel_k;                         // Outlier distance in MADs, 0 off
+    float min_dev;                          // Smallest outlier distance
+    float alpha;                            // EMA weight of a reading, 1 off
+    float max_rate;                         // Units per second, 0 off
+} dht_filter_cfg_t;
+
+typedef struct DHT_FILTER {
+    dht_filter_cfg_t cfg;
+    int count;                              // Readings in the window
+    int head;                               // Oldest reading of the ring
+    float ring[DHT_FILTER_WINDOW_MAX];      // Window in arrival order
+    float sorted[DHT_FILTER_WINDOW_MAX];    // Same readings in ascending order
+    float ema;
+    float value;                            // Last output
+    uint64_t time_ns;                       // Time of the last output
+    uint32_t outliers;                      // Readings replaced by Hampel
+} dht_filter_t;
+
+// Defaults for DHT11 readings taken every few seconds indoors
+extern const dht_filter_cfg_t DHT_FILTER_HUMIDITY;
+extern const dht_filter_cfg_t DHT_FILTER_TEMPERATURE;
+//============================================================================//
+
+//===== FUNCTION DECLARATION =================================================//
+/*!
+ * @brief Prepares a filter
+ * @param [filter] dht_filter_t - Filter to initialize
+ * @param [cfg] dht_filter_cfg_t - Stages and their parameters
+ * @return 0 if success else negative values for various possible errors
+ */
+int dht_filter_init(dht_filter_t *filter, const dht_filter_cfg_t *cfg);
+
+/*!
+ * @brief Passes a good reading through the filter
+ * @param [filter] dht_filter_t - Filter
+ * @param [value] float - Reading
+ * @param [time_ns] uint64_t - CLOCK_MONOTONIC time of the reading
+ * @return [float] Filtered value
+ */
+float dht_filter_update(dht_filter_t *filter, float value, uint64_t time_ns);
+
+/*!
+ * @brief Median and median absolute deviation of the window
+ * @param [filter] dht_filter_t - Filter
+ * @param [median] float - Output of the median
+ * @param [mad] float - Output of the MAD, unscaled
+ * @return 0 if success, DHT_ERR_ARGUMENT if the window is empty
+ */
+int dht_filter_stats(const dht_filter_t *filter, float *median, float *mad);
+//============================================================================//
+
+#endif //__DHT_FILTER_H__
@@ -0,0 +1,193 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_line.c
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added GPIO character device capture
+ *
+ * @note    This is a library written in standard C to interface DHT11 sensor
+ *          on beagle bone black
+ *
+ * @sa      doc/DHT11_Technical_Reference.pdf
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/gpio.h>
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include "dht_decoder.h"
+#include "dht_line.h"
+#include "mmio.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+static const char *DHT_LINE_CHIP = "/dev/gpiochip%d";
+static const char *DHT_LINE_CONSUMER = "dht11";
+
+// Response preamble and 40 bits of ones, slept through before draining
+static const uint32_t DHT_LINE_FRAME_US = 80 + 80 + 40 * (50 + 70) + 50;
+
+static int cdev_request(int base, int num, dht_line_t *line);
+static int cdev_drive(dht_line_t *line, int lvl);
+static int cdev_listen(dht_line_t *line);
+static void cdev_release(dht_line_t *line);
+
+const dht_line_backend_t DHT_LINE_CDEV = {
+    .name = "cdev",
+    .request = cdev_request,
+    .drive = cdev_drive,
+    .listen = cdev_listen,
+    .release = cdev_release
+};
+
+static const dht_line_backend_t *line_backend = &DHT_LINE_CDEV;
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static int cdev_request(int base, int num, dht_line_t *line) {
+    char path[32];
+    snprintf(path, sizeof(path), DHT_LINE_CHIP, base);
+    int chip = open(path, O_RDWR | O_CLOEXEC);
+    if(chip < 0) { return DHT_ERR_GPIO; }
+
+    // Output driven high, the level the start signal begins with
+    struct gpio_v2_line_request request;
+    memset(&request, 0, sizeof(request));
+    request.offsets[0] = (uint32_t) num;
+    request.num_lines = 1;
+    request.event_buffer_size = DHT_RUNS_MAX;
+    strncpy(request.consumer, DHT_LINE_CONSUMER, sizeof(request.consumer) - 1);
+    request.config.flags = GPIO_V2_LINE_FLAG_OUTPUT;
+    request.config.num_attrs = 1;
+    request.config.attrs[0].attr.id = GPIO_V2_LINE_ATTR_ID_OUTPUT_VALUES;
+    request.config.attrs[0].attr.values = 1;
+    request.config.attrs[0].mask = 1;
+
+    int result = ioctl(chip, GPIO_V2_GET_LINE_IOCTL, &request);
+    close(chip);
+    if(result < 0) { return DHT_ERR_GPIO; }
+
+    line->fd = request.fd;
+    line->priv = -1;
+    return DHT_SUCCESS;
+}
+
+static int cdev_drive(dht_line_t *line, int lvl) {
+    struct gpio_v2_line_values values;
+    memset(&values, 0, sizeof(values));
+    values.bits = lvl ? 1 : 0;
+    values.mask = 1;
+    return ioctl(line->fd, GPIO_V2_LINE_SET_VALUES_IOCTL, &values) < 0 ? DHT_ERR_GPIO : DHT_SUCCESS;
+}
+
+static int cdev_listen(dht_line_t *line) {
+    struct gpio_v2_line_config config;
+    memset(&config, 0, sizeof(config));
+    config.flags = GPIO_V2_LINE_FLAG_INPUT | GPIO_V2_LINE_FLAG_EDGE_RISING |
+        GPIO_V2_LINE_FLAG_EDGE_FALLING | GPIO_V2_LINE_FLAG_BIAS_PULL_UP;
+    if(ioctl(line->fd, GPIO_V2_LINE_SET_CONFIG_IOCTL, &config) == 0) { return DHT_SUCCESS; }
+
+    // Not every pin controller takes a bias, the sensor has its own pull-up
+    config.flags &= ~GPIO_V2_LINE_FLAG_BIAS_PULL_UP;
+    return ioctl(line->fd, GPIO_V2_LINE_SET_CONFIG_IOCTL, &config) < 0 ? DHT_ERR_GPIO : DHT_SUCCESS;
+}
+
+static void cdev_release(dht_line_t *line) {
+    close(line->fd);
+}
+
+static int dht_line_wait(int fd, uint32_t us) {
+    struct pollfd pfd = { .fd = fd, .events = POLLIN };
+    struct timespec timeout = { .tv_sec = us / 1000000, .tv_nsec = (us % 1000000) * 1000L };
+    int ready;
+    while((ready = ppoll(&pfd, 1, &timeout, NULL)) < 0 && errno == EINTR);
+    return ready > 0;
+}
+
+static int dht_line_drain(int fd, struct gpio_v2_line_event *events, int n, int max) {
+    while(n < max) {
+        ssize_t got = read(fd, &events[n], (max - n) * sizeof(*events));
+        if(got <= 0) { break; }
+        n += (int) (got / sizeof(*events));
+    }
+    return n;
+}
+
+static int dht_line_widths(const struct gpio_v2_line_event *events, int n, uint32_t *pulses) {
+    // Widths start with the response low level, earlier edges are dropped
+    int first = 0;
+    while(first < n && events[first].id != GPIO_V2_LINE_EVENT_FALLING_EDGE) { first++; }
+
+    int count = 0;
+    for(int i = first + 1; i < n && count < DHT_RUNS_MAX; i++) {
+        pulses[count++] = (uint32_t) ((events[i].timestamp_ns - events[i - 1].timestamp_ns) / 1000);
+
+        // An edge was lost in between, an empty level keeps the low/high
+        // alternation and the decoder merges it like a glitch
+        if(events[i].id == events[i - 1].id && count < DHT_RUNS_MAX) {
+            pulses[count++] = 0;
+        }
+    }
+    return count;
+}
+
+void dht_line_set_backend(const dht_line_backend_t *backend) {
+    line_backend = backend != NULL ? backend : &DHT_LINE_CDEV;
+}
+
+int dht_line_capture(int base, int num, uint32_t *pulses, int *count, uint64_t *capture_ns) {
+    memset(pulses, 0, DHT_RUNS_MAX * sizeof(uint32_t));
+    *count = 0;
+    *capture_ns = 0;
+
+    const dht_line_backend_t *backend = line_backend;
+    dht_line_t line = { .fd = -1, .priv = -1, .base = base, .num = num };
+    if(backend->request(base, num, &line) != DHT_SUCCESS) { return DHT_ERR_GPIO; }
+    fcntl(line.fd, F_SETFL, fcntl(line.fd, F_GETFL) | O_NONBLOCK);
+
+    // Start signal, the low level only needs to be long enough so it sleeps
+    sleep_ms(DHT_START_HIGH_MS);
+    int result = backend->drive(&line, LOW);
+    sleep_ms(DHT_START_LOW_MS);
+    if(result == DHT_SUCCESS) { result = backend->listen(&line); }
+    if(result != DHT_SUCCESS) {
+        backend->release(&line);
+        return DHT_ERR_GPIO;
+    }
+    uint64_t start = dht_now_ns();
+
+    // Wait for DHT to pull the line low, then sleep through the frame while
+    // the kernel queues the edges and drain them until the line rests
+    struct gpio_v2_line_event events[DHT_RUNS_MAX + 1];
+    int n = 0;
+    if(dht_line_wait(line.fd, DHT_RESPONSE_TIMEOUT_US)) {
+        struct timespec frame = { .tv_sec = 0, .tv_nsec = DHT_LINE_FRAME_US * 1000L };
+        nanosleep(&frame, NULL);
+        do {
+            n = dht_line_drain(line.fd, events, n, DHT_RUNS_MAX + 1);
+        } while(n < DHT_RUNS_MAX + 1 && dht_line_wait(line.fd, DHT_PULSE_TIMEOUT_US));
+    }
+    *capture_ns = dht_now_ns() - start;
+    backend->release(&line);
+
+    *count = dht_line_widths(events, n, pulses);
+    return *count >= (int) DHT_PULSES * 2 ? DHT_SUCCESS : DHT_ERR_TIMEOUT;
+}
+//============================================================================//
@@ -0,0 +1,90 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_line.h
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added GPIO character device capture
+ *
+ * @note    DHT_CAPTURE_EVENT reads through the GPIO character device (uAPI v2)
+ *          instead of /dev/mem. The line is requested from /dev/gpiochipN for
+ *          gpio base N, the start signal is driven with line values and the
+ *          response is captured as edge events timestamped by the kernel in
+ *          its interrupt handler. The reader sleeps through the frame and
+ *          drains the queued edges in one batch, neither root nor FIFO
+ *          priority is needed, only access to the gpiochip device.
+ *
+ *          The line is switched to input after the start signal by a
+ *          reconfiguration ioctl, on a slow system the response preamble may
+ *          pass before edge detection is armed. The decoder resynchronizes on
+ *          the data bits in that case.
+ *
+ * @sa      doc/DHT11_Technical_Reference.pdf
+ *
+ */
+
+#ifndef __DHT_LINE_H__
+#define __DHT_LINE_H__
+
+//===== INCLUDE ==============================================================//
+#include "dht_common.h"
+//============================================================================//
+
+//===== TYPES, CONSTANTS AND VARIABLES =======================================//
+typedef struct DHT_LINE {
+    int fd;                     // Delivers struct gpio_v2_line_event records
+    int priv;                   // Descriptor private to the backend, or -1
+    int base;                   // Gpio base of the line (0..3)
+    int num;                    // Gpio number of the line (0..31)
+} dht_line_t;
+
+/*!
+ * @brief Access to a sensor line used by DHT_CAPTURE_EVENT. The default
+ *        backend uses the GPIO character device, a simulated one can replace
+ *        it to deliver synthetic edges (see dht_sim.h).
+ */
+typedef struct DHT_LINE_BACKEND {
+    const char *name;
+    int (*request)(int base, int num, dht_line_t *line);    // Output, high
+    int (*drive)(dht_line_t *line, int lvl);                // Output level
+    int (*listen)(dht_line_t *line);                        // Input, edges
+    void (*release)(dht_line_t *line);
+} dht_line_backend_t;
+
+extern const dht_line_backend_t DHT_LINE_CDEV;
+//============================================================================//
+
+//===== FUNCTION DECLARATION =================================================//
+/*!
+ * @brief Selects the backend used by DHT_CAPTURE_EVENT
+ * @param [backend] dht_line_backend_t - Backend to use, NULL restores the
+ *        GPIO character device
+ * @return None
+ */
+void dht_line_set_backend(const dht_line_backend_t *backend);
+
+/*!
+ * @brief Sends the start signal and captures the response as edge events,
+ *        sleeping while the frame is on the wire
+ * @param [base] int - Gpio base where the sensor is connected (0..3)
+ * @param [num] int - GPIO pin number where the sensor is connected (0..31)
+ * @param [pulses] uint32_t - Output of DHT_RUNS_MAX pulse widths in
+ *        microseconds, starting with the response low level
+ * @param [count] int - Output of the number of widths measured
+ * @param [capture_ns] uint64_t - Output of the time from the release of the
+ *        line to the last edge
+ * @return 0 if success, DHT_ERR_GPIO if the line can not be requested, else
+ *         DHT_ERR_TIMEOUT if fewer than DHT_PULSES * 2 widths
+ */
+int dht_line_capture(int base, int num, uint32_t *pulses, int *count, uint64_t *capture_ns);
+//============================================================================//
+
+#endif //__DHT_LINE_H__
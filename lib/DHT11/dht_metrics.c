@@ -0,0 +1,361 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_metrics.c
+ * @version v1.2.0 -- CHANGELOG
+ *                  | v1.0.0 - Added read path metrics
+ *                  | v1.0.1 - Pulse extremes exported as gauges
+ *                  | v1.1.0 - Pulse statistics from the decoded frame
+ *                  | v1.1.1 - Socket snapshots sent without SIGPIPE
+ *                  | v1.1.2 - Threshold statistic is the decoder's split
+ *                  | v1.2.0 - dht_err_e results from the exporters
+ *
+ * @note    This is a library written in standard C to instrument the DHT
+ *          readers on beagle bone black
+ *
+ * @sa      https://prometheus.io/docs/instrumenting/exposition_formats/
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "dht_metrics.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+// Histogram bucket k counts durations up to 2^k microseconds (~8.4 s max)
+#define DHT_METRICS_BUCKETS     24
+
+// Outcomes indexed by -dht_err_e
+#define DHT_METRICS_RESULTS     5
+
+static const char *const DHT_METRICS_RESULT_NAMES[DHT_METRICS_RESULTS] = {
+    "success",
+    "gpio",
+    "argument",
+    "checksum",
+    "timeout"
+};
+
+typedef enum DHT_PULSE_STAT {
+    DHT_PULSE_LOW,
+    DHT_PULSE_HIGH,
+    DHT_PULSE_THRESHOLD,
+    DHT_PULSE_STATS
+} dht_pulse_stat_e;
+
+static const char *const DHT_PULSE_STAT_NAMES[DHT_PULSE_STATS][3] = {
+    { "dht_pulse_low", "Width of the data bit low pulses.", "data bit low pulses." },
+    { "dht_pulse_high", "Width of the data bit high pulses.", "data bit high pulses." },
+    { "dht_pulse_threshold", "High pulse width the decoder split 0 and 1 bits at.",
+        "decoder thresholds of the reads." }
+};
+
+// Running statistic, the minimum is kept inverted so zero means unset
+typedef struct DHT_STAT {
+    uint64_t count;
+    uint64_t sum;
+    uint64_t max;
+    uint64_t min_inv;
+} dht_stat_t;
+
+typedef struct DHT_HISTOGRAM {
+    uint64_t bucket[DHT_METRICS_BUCKETS];
+    uint64_t count;
+    uint64_t sum_ns;
+} dht_histogram_t;
+
+typedef struct DHT_SENSOR_METRICS {
+    uint32_t key;                           // (base << 8 | num) + 1, 0 if free
+    uint64_t results[DHT_METRICS_RESULTS];
+    dht_histogram_t read;
+    dht_histogram_t capture;
+    dht_stat_t pulse[2][DHT_PULSE_STATS];   // Per dht_capture_e unit
+} dht_sensor_metrics_t;
+
+static dht_sensor_metrics_t sensors[DHT_METRICS_SENSORS];
+
+// Unix socket exporter
+static pthread_t serve_thread;
+static int serve_fd = -1;
+static char serve_path[sizeof(((struct sockaddr_un *) 0)->sun_path)];
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static dht_sensor_metrics_t *dht_metrics_sensor(int base, int num) {
+    uint32_t key = ((uint32_t) base << 8 | (uint32_t) num) + 1;
+
+    // Slots are claimed once and never released, lookups stay lock free
+    for(int i = 0; i < DHT_METRICS_SENSORS; i++) {
+        uint32_t cur = __atomic_load_n(&sensors[i].key, __ATOMIC_ACQUIRE);
+        if(cur == key) { return &sensors[i]; }
+        if(cur == 0 && __atomic_compare_exchange_n(&sensors[i].key, &cur, key, 0,
+                __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            return &sensors[i];
+        }
+        if(cur == key) { return &sensors[i]; }
+    }
+    return NULL;
+}
+
+static void dht_metrics_max(uint64_t *dst, uint64_t value) {
+    uint64_t cur = __atomic_load_n(dst, __ATOMIC_RELAXED);
+    while(value > cur && !__atomic_compare_exchange_n(dst, &cur, value, 1,
+            __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
+
+static void dht_metrics_stat(dht_stat_t *stat, uint64_t value) {
+    __atomic_fetch_add(&stat->count, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&stat->sum, value, __ATOMIC_RELAXED);
+    dht_metrics_max(&stat->max, value);
+    dht_metrics_max(&stat->min_inv, UINT64_MAX - value);
+}
+
+static void dht_metrics_observe(dht_histogram_t *hist, uint64_t ns) {
+    uint64_t us = ns / 1000;
+    int index = us <= 1 ? 0 : 64 - __builtin_clzll(us - 1);
+    if(index < DHT_METRICS_BUCKETS) {
+        __atomic_fetch_add(&hist->bucket[index], 1, __ATOMIC_RELAXED);
+    }
+    __atomic_fetch_add(&hist->count, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&hist->sum_ns, ns, __ATOMIC_RELAXED);
+}
+
+void dht_metrics_record(int base, int num, int status, uint64_t total_ns,
+    uint64_t capture_ns, dht_capture_e mode, const dht_frame_t *frame) {
+    if(base < 0 || base > 3 || num < 0 || num > 31) { return; }
+    if(status > 0 || status <= -DHT_METRICS_RESULTS) { return; }
+
+    dht_sensor_metrics_t *sensor = dht_metrics_sensor(base, num);
+    if(sensor == NULL) { return; }
+
+    __atomic_fetch_add(&sensor->results[-status], 1, __ATOMIC_RELAXED);
+    dht_metrics_observe(&sensor->read, total_ns);
+    if(capture_ns > 0) {
+        dht_metrics_observe(&sensor->capture, capture_ns);
+    }
+    if(frame == NULL || frame->status != DHT_SUCCESS) { return; }
+
+    // Data bits as the decoder aligned them, damaged frames would skew them
+    dht_stat_t *stat = sensor->pulse[mode == DHT_CAPTURE_COUNT ? 0 : 1];
+    for(int b = 0; b < DHT_FRAME_BITS; b++) {
+        dht_metrics_stat(&stat[DHT_PULSE_LOW], frame->lows[b]);
+        dht_metrics_stat(&stat[DHT_PULSE_HIGH], frame->highs[b]);
+    }
+    dht_metrics_stat(&stat[DHT_PULSE_THRESHOLD], frame->threshold);
+}
+
+static void dht_metrics_histogram(FILE *out, const char *name, const char *labels,
+    const dht_histogram_t *hist) {
+    uint64_t cumulative = 0;
+    for(int k = 0; k < DHT_METRICS_BUCKETS; k++) {
+        cumulative += __atomic_load_n(&hist->bucket[k], __ATOMIC_RELAXED);
+        fprintf(out, "%s_bucket{%s,le=\"%.6f\"} %llu\n", name, labels,
+            (double) (1ULL << k) / 1e6, (unsigned long long) cumulative);
+    }
+
+    uint64_t count = __atomic_load_n(&hist->count, __ATOMIC_RELAXED);
+    uint64_t sum = __atomic_load_n(&hist->sum_ns, __ATOMIC_RELAXED);
+    fprintf(out, "%s_bucket{%s,le=\"+Inf\"} %llu\n", name, labels, (unsigned long long) count);
+    fprintf(out, "%s_sum{%s} %.9f\n", name, labels, sum / 1e9);
+    fprintf(out, "%s_count{%s} %llu\n", name, labels, (unsigned long long) count);
+}
+
+int dht_metrics_export(FILE *out) {
+    if(out == NULL) { return DHT_ERR_ARGUMENT; }
+
+    fprintf(out, "# HELP dht_reads_total DHT reads by result.\n");
+    fprintf(out, "# TYPE dht_reads_total counter\n");
+    for(int i = 0; i < DHT_METRICS_SENSORS; i++) {
+        uint32_t key = __atomic_load_n(&sensors[i].key, __ATOMIC_ACQUIRE);
+        if(key == 0) { continue; }
+        for(int r = 0; r < DHT_METRICS_RESULTS; r++) {
+            fprintf(out, "dht_reads_total{base=\"%u\",pin=\"%u\",result=\"%s\"} %llu\n",
+                (key - 1) >> 8, (key - 1) & 0xFF, DHT_METRICS_RESULT_NAMES[r],
+                (unsigned long long) __atomic_load_n(&sensors[i].results[r], __ATOMIC_RELAXED));
+        }
+    }
+
+    const char *hists[2][2] = {
+        { "dht_read_seconds", "Duration of a whole DHT read." },
+        { "dht_capture_seconds", "Duration of the DHT capture phase." }
+    };
+    for(int h = 0; h < 2; h++) {
+        fprintf(out, "# HELP %s %s\n", hists[h][0], hists[h][1]);
+        fprintf(out, "# TYPE %s histogram\n", hists[h][0]);
+        for(int i = 0; i < DHT_METRICS_SENSORS; i++) {
+            uint32_t key = __atomic_load_n(&sensors[i].key, __ATOMIC_ACQUIRE);
+            if(key == 0) { continue; }
+
+            char labels[32];
+            snprintf(labels, sizeof(labels), "base=\"%u\",pin=\"%u\"", (key - 1) >> 8, (key - 1) & 0xFF);
+            dht_metrics_histogram(out, hists[h][0], labels, h == 0 ? &sensors[i].read : &sensors[i].capture);
+        }
+    }
+
+    for(int s = 0; s < DHT_PULSE_STATS; s++) {
+        const char *name = DHT_PULSE_STAT_NAMES[s][0];
+        fprintf(out, "# HELP %s %s\n", name, DHT_PULSE_STAT_NAMES[s][1]);
+        fprintf(out, "# TYPE %s summary\n", name);
+        for(int i = 0; i < DHT_METRICS_SENSORS; i++) {
+            uint32_t key = __atomic_load_n(&sensors[i].key, __ATOMIC_ACQUIRE);
+            if(key == 0) { continue; }
+
+            for(int m = 0; m < 2; m++) {
+                const dht_stat_t *stat = &sensors[i].pulse[m][s];
+                uint64_t count = __atomic_load_n(&stat->count, __ATOMIC_RELAXED);
+                if(count == 0) { continue; }
+
+                char labels[48];
+                snprintf(labels, sizeof(labels), "base=\"%u\",pin=\"%u\",unit=\"%s\"",
+                    (key - 1) >> 8, (key - 1) & 0xFF, m == 0 ? "loops" : "us");
+                fprintf(out, "%s_sum{%s} %llu\n", name, labels,
+                    (unsigned long long) __atomic_load_n(&stat->sum, __ATOMIC_RELAXED));
+                fprintf(out, "%s_count{%s} %llu\n", name, labels, (unsigned long long) count);
+            }
+        }
+
+        // A summary holds only sums, counts and quantiles, the extremes are
+        // families of their own
+        for(int e = 0; e < 2; e++) {
+            fprintf(out, "# HELP %s_%s %s of the %s\n", name, e == 0 ? "min" : "max",
+                e == 0 ? "Smallest" : "Largest", DHT_PULSE_STAT_NAMES[s][2]);
+            fprintf(out, "# TYPE %s_%s gauge\n", name, e == 0 ? "min" : "max");
+            for(int i = 0; i < DHT_METRICS_SENSORS; i++) {
+                uint32_t key = __atomic_load_n(&sensors[i].key, __ATOMIC_ACQUIRE);
+                if(key == 0) { continue; }
+
+                for(int m = 0; m < 2; m++) {
+                    const dht_stat_t *stat = &sensors[i].pulse[m][s];
+                    if(__atomic_load_n(&stat->count, __ATOMIC_RELAXED) == 0) { continue; }
+
+                    uint64_t value = e == 0 ? UINT64_MAX - __atomic_load_n(&stat->min_inv, __ATOMIC_RELAXED) :
+                        __atomic_load_n(&stat->max, __ATOMIC_RELAXED);
+                    fprintf(out, "%s_%s{base=\"%u\",pin=\"%u\",unit=\"%s\"} %llu\n", name, e == 0 ? "min" : "max",
+                        (key - 1) >> 8, (key - 1) & 0xFF, m == 0 ? "loops" : "us", (unsigned long long) value);
+                }
+            }
+        }
+    }
+
+    fprintf(out, "# HELP dht_fifo_seconds_total Time spent at SCHED_FIFO priority.\n");
+    fprintf(out, "# TYPE dht_fifo_seconds_total counter\n");
+    fprintf(out, "dht_fifo_seconds_total %.9f\n", dht_fifo_time_ns() / 1e9);
+    fprintf(out, "# HELP dht_fifo_entries_total Switches to SCHED_FIFO priority.\n");
+    fprintf(out, "# TYPE dht_fifo_entries_total counter\n");
+    fprintf(out, "dht_fifo_entries_total %llu\n", (unsigned long long) dht_fifo_entries());
+
+    return ferror(out) ? DHT_ERR_FILE : DHT_SUCCESS;
+}
+
+int dht_metrics_write_file(const char *path) {
+    if(path == NULL) { return DHT_ERR_ARGUMENT; }
+
+    size_t len = strlen(path);
+    char *tmp = malloc(len + 5);
+    if(tmp == NULL) { return DHT_ERR_FILE; }
+    memcpy(tmp, path, len);
+    memcpy(tmp + len, ".tmp", 5);
+
+    FILE *out = fopen(tmp, "w");
+    if(out == NULL) {
+        free(tmp);
+        return DHT_ERR_FILE;
+    }
+
+    int result = dht_metrics_export(out);
+    if(fclose(out) != 0) { result = DHT_ERR_FILE; }
+    if(result == DHT_SUCCESS && rename(tmp, path) != 0) { result = DHT_ERR_FILE; }
+    if(result != DHT_SUCCESS) { unlink(tmp); }
+
+    free(tmp);
+    return result;
+}
+
+static void *dht_metrics_run(void *arg) {
+    int fd = (int) (intptr_t) arg;
+
+    // Each connection gets one snapshot, then it is closed
+    for(;;) {
+        int client = accept(fd, NULL, NULL);
+        if(client < 0) { break; }
+
+        // Formatted aside and sent without SIGPIPE, a scraper hanging up
+        // mid-snapshot only drops its own connection
+        char *text = NULL;
+        size_t len = 0;
+        FILE *out = open_memstream(&text, &len);
+        if(out != NULL) {
+            int result = dht_metrics_export(out);
+            if(fclose(out) == 0 && result == DHT_SUCCESS) {
+                for(size_t sent = 0; sent < len;) {
+                    ssize_t n = send(client, text + sent, len - sent, MSG_NOSIGNAL);
+                    if(n < 0 && errno == EINTR) { continue; }
+                    if(n <= 0) { break; }
+                    sent += (size_t) n;
+                }
+            }
+            free(text);
+        }
+        close(client);
+    }
+
+    return NULL;
+}
+
+int dht_metrics_serve(const char *path) {
+    if(path == NULL || serve_fd >= 0) { return DHT_ERR_ARGUMENT; }
+
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if(strlen(path) >= sizeof(addr.sun_path)) { return DHT_ERR_ARGUMENT; }
+    strcpy(addr.sun_path, path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if(fd < 0) { return DHT_ERR_FILE; }
+
+    unlink(path);
+    if(bind(fd, (struct sockaddr *) &addr, sizeof(addr)) != 0 || listen(fd, 4) != 0) {
+        close(fd);
+        return DHT_ERR_FILE;
+    }
+
+    if(pthread_create(&serve_thread, NULL, dht_metrics_run, (void *) (intptr_t) fd) != 0) {
+        close(fd);
+        unlink(path);
+        return DHT_ERR_FILE;
+    }
+
+    serve_fd = fd;
+    strcpy(serve_path, path);
+    return DHT_SUCCESS;
+}
+
+void dht_metrics_stop(void) {
+    if(serve_fd < 0) { return; }
+
+    // Shutting the listening socket down makes accept return
+    shutdown(serve_fd, SHUT_RDWR);
+    pthread_join(serve_thread, NULL);
+    close(serve_fd);
+    unlink(serve_path);
+    serve_fd = -1;
+}
+//============================================================================//
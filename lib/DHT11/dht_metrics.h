@@ -0,0 +1,100 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_metrics.h
+ * @version v1.2.0 -- CHANGELOG
+ *                  | v1.0.0 - Added read path metrics
+ *                  | v1.1.0 - Pulse statistics from the decoded frame
+ *                  | v1.1.1 - Threshold statistic is the decoder's split
+ *                  | v1.2.0 - dht_err_e results from the exporters
+ *
+ * @note    Every reader of the library records its outcome here once the
+ *          capture is over, nothing is recorded from inside the capture loop.
+ *          Counters are updated with relaxed atomics and exported in the
+ *          Prometheus text format to a file or a local unix socket.
+ *
+ *          Per sensor:
+ *          - dht_read_seconds / dht_capture_seconds histograms (log2 buckets)
+ *          - dht_reads_total{result=...} counter per dht_err_e outcome
+ *          - dht_pulse_low/high running count, sum, min and max of the data
+ *            bit widths, dht_pulse_threshold of the decoder's 0/1 split
+ *          Global:
+ *          - dht_fifo_seconds_total / dht_fifo_entries_total
+ *
+ * @sa      https://prometheus.io/docs/instrumenting/exposition_formats/
+ *
+ */
+
+#ifndef __DHT_METRICS_H__
+#define __DHT_METRICS_H__
+
+//===== INCLUDE ==============================================================//
+#include <stdio.h>
+
+#include "dht_common.h"
+#include "dht_decoder.h"
+//============================================================================//
+
+//===== TYPES, CONSTANTS AND VARIABLES =======================================//
+#define DHT_METRICS_SENSORS     16
+//============================================================================//
+
+//===== FUNCTION DECLARATION =================================================//
+/*!
+ * @brief Records the outcome of one read of a sensor
+ * @param [base] int - Gpio base of the sensor (0..3)
+ * @param [num] int - GPIO number of the sensor (0..31)
+ * @param [status] int - dht_err_e result of the read
+ * @param [total_ns] uint64_t - Duration of the whole read
+ * @param [capture_ns] uint64_t - Duration of the capture phase, 0 if none
+ * @param [mode] dht_capture_e - Unit of the pulse widths
+ * @param [frame] dht_frame_t - Decoded frame whose bit widths go into the
+ *        pulse statistics if its checksum passed, NULL if none
+ * @return None
+ */
+void dht_metrics_record(int base, int num, int status, uint64_t total_ns,
+    uint64_t capture_ns, dht_capture_e mode, const dht_frame_t *frame);
+
+/*!
+ * @brief Writes all metrics in the Prometheus text format
+ * @param [out] FILE - Stream to write to
+ * @return 0 if success, DHT_ERR_ARGUMENT without a stream, else
+ *         DHT_ERR_FILE if the stream failed
+ */
+int dht_metrics_export(FILE *out);
+
+/*!
+ * @brief Writes all metrics to a file, replacing it atomically so a scraper
+ *        (e.g. node_exporter textfile collector) never reads a partial file
+ * @param [path] char - Destination file
+ * @return 0 if success, DHT_ERR_ARGUMENT without a path, else DHT_ERR_FILE
+ */
+int dht_metrics_write_file(const char *path);
+
+/*!
+ * @brief Starts a thread answering every connection on a unix socket with
+ *        the current metrics
+ * @param [path] char - Path of the socket, replaced if it exists
+ * @return 0 if success, DHT_ERR_ARGUMENT for a missing or too long path or
+ *         when already serving, else DHT_ERR_FILE
+ */
+int dht_metrics_serve(const char *path);
+
+/*!
+ * @brief Stops the unix socket thread and removes the socket
+ * @param None
+ * @return None
+ */
+void dht_metrics_stop(void);
+//============================================================================//
+
+#endif //__DHT_METRICS_H__
@@ -0,0 +1,250 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_pulse.h
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added timed bit-bang engine
+ *
+ * @note    Runs the timed part of a single wire protocol from a table of
+ *          steps: drive or release a line for a time, wait for a level,
+ *          measure one level or capture a train of them, and write or read
+ *          bits in fixed time slots (1-Wire). The DHT capture, the HC-SR04
+ *          and the DS18B20 readers are such tables.
+ *
+ *          dht_pulse_run() is always inlined. Called with a table that is a
+ *          static const of the caller, the compiler unrolls the steps and
+ *          folds their timings, so every protocol gets its own hot loop
+ *          without a copy of the spin code. Buffers belong to the caller,
+ *          nothing is allocated.
+ *
+ *          Callers set the priority (set_max_priority) around a run and do
+ *          the long sleeps, such as the DHT start signal, before it.
+ *
+ */
+
+#ifndef __DHT_PULSE_H__
+#define __DHT_PULSE_H__
+
+//===== INCLUDE ==============================================================//
+#include "dht_common.h"
+#include "mmio.h"
+//============================================================================//
+
+//===== TYPES, CONSTANTS AND VARIABLES =======================================//
+#define DHT_PULSE_BYTES_MAX     16
+
+typedef enum DHT_PULSE_OP {
+    DHT_PULSE_DRIVE,                        // Drive level, hold it us
+    DHT_PULSE_RELEASE,                      // Switch to input, wait us
+    DHT_PULSE_WAIT,                         // Until level shows, us timeout
+    DHT_PULSE_MEASURE,                      // Width of level, us timeout
+    DHT_PULSE_CAPTURE,                      // Widths of count levels from level
+                                            // on, until one lasts us
+    DHT_PULSE_WRITE,                        // count bits of out in slots
+    DHT_PULSE_READ                          // count bits into in in slots
+} dht_pulse_op_e;
+
+typedef struct DHT_PULSE_STEP {
+    uint8_t op;                             // dht_pulse_op_e
+    uint8_t pin;                            // Index into the pins of the run
+    uint8_t level;
+    uint16_t count;
+    uint32_t us;
+} dht_pulse_step_t;
+
+typedef struct DHT_PULSE_SLOT {
+    uint32_t low1_us;                       // Low writing a 1 or opening a read
+    uint32_t low0_us;                       // Low writing a 0
+    uint32_t sample_us;                     // Read sample from the slot start
+    uint32_t slot_us;                       // Whole slot with its recovery
+} dht_pulse_slot_t;
+
+typedef struct DHT_PULSE_PROTO {
+    const dht_pulse_step_t *steps;
+    int count;
+    dht_pulse_slot_t slot;                  // Timing of WRITE and READ
+} dht_pulse_proto_t;
+
+typedef struct DHT_PULSE_BUF {
+    uint32_t *widths;                       // MEASURE and CAPTURE output
+    int max;                                // Room in widths
+    int count;                              // Widths stored
+    uint8_t out[DHT_PULSE_BYTES_MAX];       // Bits to WRITE, LSB first
+    uint8_t in[DHT_PULSE_BYTES_MAX];        // Bits READ, LSB first
+    int out_bits;                           // Bits written so far
+    int in_bits;                            // Bits read so far
+    int step;                               // Step that timed out
+} dht_pulse_buf_t;
+//============================================================================//
+
+//===== FUNCTION DECLARATION =================================================//
+/*!
+ * @brief Counts loop iterations while a pin stays at a level. The count mode
+ *        capture and the calibration share it so they run the same loop.
+ * @param [pin] gpio_t - Pin to watch, set as input
+ * @param [level] uint32_t - 0 while low, 1 while high
+ * @param [max] uint32_t - Iterations after which counting stops
+ * @return [uint32_t] Iterations counted, max if the level did not change
+ */
+static inline uint32_t dht_count_level(gpio_t pin, uint32_t level, uint32_t max) {
+    uint32_t count = 0;
+    while((mmio_input(pin) != 0) == level) {
+        if(++count >= max) { break; }
+    }
+    return count;
+}
+
+/*!
+ * @brief Spins while a pin stays at a level, timed with dht_ticks()
+ * @param [pin] gpio_t - Pin to watch, set as input
+ * @param [level] uint32_t - 0 while low, 1 while high
+ * @param [timeout] uint32_t - Ticks after which it gives up
+ * @param [now] uint32_t - Tick the level started, updated to when it ended
+ * @return [int] 1 if the level ended else 0
+ */
+static inline __attribute__((always_inline))
+int dht_pulse_spin(gpio_t pin, uint32_t level, uint32_t timeout, uint32_t *now) {
+    const uint32_t edge = *now;
+    while((mmio_input(pin) != 0) == level) {
+        *now = dht_ticks();
+        if(*now - edge >= timeout) { return 0; }
+    }
+    return 1;
+}
+
+/*!
+ * @brief Busy-waits until a number of ticks passed since a start tick
+ * @param [start] uint32_t - Tick to count from
+ * @param [ticks] uint32_t - Ticks to wait
+ * @return [uint32_t] Tick the wait ended
+ */
+static inline __attribute__((always_inline)) uint32_t dht_pulse_hold(uint32_t start, uint32_t ticks) {
+    uint32_t now;
+    while((now = dht_ticks()) - start < ticks);
+    return now;
+}
+
+/*!
+ * @brief Runs the steps of a protocol
+ * @param [pins] gpio_t - Pins the steps refer to by index
+ * @param [proto] dht_pulse_proto_t - Steps and slot timing
+ * @param [buf] dht_pulse_buf_t - Widths, bits to write and bits read
+ * @param [loops_per_ms] uint32_t - 0 to time waits and widths in
+ *        microseconds, else the calibrated speed of dht_count_level() to
+ *        count them in loop iterations
+ * @return 0 if success else DHT_ERR_TIMEOUT with the step in buf->step. A
+ *         capture ends on its timeout and is never an error.
+ */
+static inline __attribute__((always_inline))
+int dht_pulse_run(const gpio_t *pins, const dht_pulse_proto_t *proto, dht_pulse_buf_t *buf,
+    uint32_t loops_per_ms) {
+    const uint32_t tpus = dht_ticks_per_us();
+    const dht_pulse_slot_t *slot = &proto->slot;
+    uint32_t now = dht_ticks();
+    buf->count = 0;
+    buf->out_bits = 0;
+    buf->in_bits = 0;
+
+    for(int s = 0; s < proto->count; s++) {
+        const dht_pulse_step_t *step = &proto->steps[s];
+        const gpio_t pin = pins[step->pin];
+        const uint32_t level = step->level;
+        const uint32_t timeout = loops_per_ms ? (uint32_t) ((uint64_t) step->us * loops_per_ms / 1000) :
+            step->us * tpus;
+        buf->step = s;
+
+        switch(step->op) {
+        case DHT_PULSE_DRIVE:
+            mmio_set_output(pin);
+            mmio_set_level(pin, (int) level);
+            now = dht_pulse_hold(dht_ticks(), step->us * tpus);
+            break;
+
+        case DHT_PULSE_RELEASE:
+            mmio_set_input(pin);
+            now = dht_pulse_hold(dht_ticks(), step->us * tpus);
+            break;
+
+        case DHT_PULSE_WAIT:
+            if(loops_per_ms) {
+                if(dht_count_level(pin, !level, timeout) >= timeout) { return DHT_ERR_TIMEOUT; }
+            } else if(!dht_pulse_spin(pin, !level, timeout, &now)) {
+                return DHT_ERR_TIMEOUT;
+            }
+            break;
+
+        case DHT_PULSE_MEASURE:
+        case DHT_PULSE_CAPTURE: {
+            // Levels alternate, one that outlasts the timeout ends a capture
+            const int runs = step->op == DHT_PULSE_MEASURE ? 1 : step->count;
+            const int first = buf->count;
+            for(int r = 0; r < runs && buf->count < buf->max; r++) {
+                const uint32_t at = (level + (uint32_t) r) & 1;
+                uint32_t width;
+                if(loops_per_ms) {
+                    width = dht_count_level(pin, at, timeout);
+                    if(width >= timeout) { break; }
+                } else {
+                    const uint32_t edge = now;
+                    if(!dht_pulse_spin(pin, at, timeout, &now)) { break; }
+                    width = now - edge;
+                }
+                buf->widths[buf->count++] = width;
+            }
+
+            // Ticks become microseconds once the line is no longer watched
+            for(int w = first; !loops_per_ms && w < buf->count; w++) { buf->widths[w] /= tpus; }
+            if(step->op == DHT_PULSE_MEASURE && buf->count == first) { return DHT_ERR_TIMEOUT; }
+            break;
+        }
+
+        case DHT_PULSE_WRITE:
+            for(int b = 0; b < step->count && buf->out_bits < DHT_PULSE_BYTES_MAX * 8; b++) {
+                const int bit = (buf->out[buf->out_bits >> 3] >> (buf->out_bits & 7)) & 1;
+                const uint32_t start = dht_ticks();
+                mmio_set_output(pin);
+                mmio_set_low(pin);
+                dht_pulse_hold(start, (bit ? slot->low1_us : slot->low0_us) * tpus);
+                mmio_set_input(pin);
+                now = dht_pulse_hold(start, slot->slot_us * tpus);
+                buf->out_bits++;
+            }
+            break;
+
+        case DHT_PULSE_READ:
+            for(int b = 0; b < step->count && buf->in_bits < DHT_PULSE_BYTES_MAX * 8; b++) {
+                const uint32_t start = dht_ticks();
+                mmio_set_output(pin);
+                mmio_set_low(pin);
+                dht_pulse_hold(start, slot->low1_us * tpus);
+                mmio_set_input(pin);
+                dht_pulse_hold(start, slot->sample_us * tpus);
+                const uint8_t mask = (uint8_t) (1u << (buf->in_bits & 7));
+                if(mmio_input(pin)) {
+                    buf->in[buf->in_bits >> 3] |= mask;
+                } else {
+                    buf->in[buf->in_bits >> 3] &= (uint8_t) ~mask;
+                }
+                now = dht_pulse_hold(start, slot->slot_us * tpus);
+                buf->in_bits++;
+            }
+            break;
+
+        default:
+            break;
+        }
+    }
+    return DHT_SUCCESS;
+}
+//============================================================================//
+
+#endif //__DHT_PULSE_H__
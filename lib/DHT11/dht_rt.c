@@ -0,0 +1,204 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_rt.c
+ * @version v1.1.0 -- CHANGELOG
+ *                  | v1.0.0 - Added real-time capture mode
+ *                  | v1.0.1 - Overrun handler keeps errno, unused sig marked
+ *                  | v1.1.0 - Mode left off when memory can not be locked
+ *
+ * @note    This is a library written in standard C to interface DHT11 sensor
+ *          on beagle bone black
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#define _GNU_SOURCE
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include "dht_rt.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+static const dht_rt_cfg_t DHT_RT_DEFAULTS = {
+    .cpu = -1,
+    .isolated = 1,
+    .priority = 0,
+    .fifo_max_us = 50000,
+    .prefault_kb = 64
+};
+
+static pthread_mutex_t rt_lock = PTHREAD_MUTEX_INITIALIZER;
+static int rt_enabled = 0;
+static int rt_cpu = -1;
+static dht_rt_cfg_t rt_cfg;
+static uint64_t rt_overruns = 0;
+static struct rlimit rt_saved_limit;
+static struct sigaction rt_saved_action;
+
+// Affinity of the thread before dht_rt_enter, restored by dht_rt_leave
+static __thread int rt_pinned = 0;
+static __thread int rt_prefaulted = 0;
+static __thread cpu_set_t rt_affinity;
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static int dht_rt_isolated(void) {
+    FILE *file = fopen("/sys/devices/system/cpu/isolated", "r");
+    if(file == NULL) { return -1; }
+
+    // CPU list such as "2-3,5", the first one is taken
+    int cpu = -1;
+    if(fscanf(file, "%d", &cpu) != 1) { cpu = -1; }
+    fclose(file);
+    return cpu;
+}
+
+static int dht_rt_pick(const dht_rt_cfg_t *cfg) {
+    if(cfg->cpu >= 0) { return cfg->cpu; }
+
+    if(cfg->isolated) {
+        int cpu = dht_rt_isolated();
+        if(cpu >= 0) { return cpu; }
+    }
+
+    // Otherwise the last CPU allowed, CPU 0 takes most interrupts
+    cpu_set_t allowed;
+    if(sched_getaffinity(0, sizeof(allowed), &allowed) < 0) { return -1; }
+    for(int cpu = CPU_SETSIZE - 1; cpu >= 0; cpu--) {
+        if(CPU_ISSET(cpu, &allowed)) { return cpu; }
+    }
+    return -1;
+}
+
+static void __attribute__((noinline)) dht_rt_prefault(uint32_t kb) {
+    // Touch every page the capture may grow the stack into
+    volatile uint8_t stack[kb * 1024 + 1];
+    for(uint32_t i = 0; i < kb * 1024; i += 4096) {
+        stack[i] = 0;
+    }
+    (void) stack[0];
+}
+
+static void dht_rt_overrun(int sig) {
+    (void) sig;
+
+    // Only the thread that ran over its bound receives it, and it is still
+    // spinning in a capture at FIFO priority, so it is dropped right here
+    // rather than once the read returns. sched_setscheduler() is a bare
+    // syscall touching no lock or heap, errno is kept for the interrupted
+    // code.
+    int saved = errno;
+    struct sched_param sched = { .sched_priority = 0 };
+    sched_setscheduler(0, SCHED_OTHER, &sched);
+    __atomic_fetch_add(&rt_overruns, 1, __ATOMIC_RELAXED);
+    errno = saved;
+}
+
+int dht_rt_enable(const dht_rt_cfg_t *cfg) {
+    if(cfg == NULL) { cfg = &DHT_RT_DEFAULTS; }
+
+    int cpu = dht_rt_pick(cfg);
+    if(cpu < 0 || cpu >= CPU_SETSIZE || cpu >= sysconf(_SC_NPROCESSORS_CONF)) { return DHT_ERR_ARGUMENT; }
+
+    // Pages mapped from now on are locked as well, nothing is set up when
+    // that is not allowed (CAP_IPC_LOCK or RLIMIT_MEMLOCK)
+    if(mlockall(MCL_CURRENT | MCL_FUTURE) != 0) { return DHT_ERR_MEMORY; }
+
+    pthread_mutex_lock(&rt_lock);
+    if(!rt_enabled) {
+        getrlimit(RLIMIT_RTTIME, &rt_saved_limit);
+
+        struct sigaction action;
+        memset(&action, 0, sizeof(action));
+        action.sa_handler = dht_rt_overrun;
+        sigemptyset(&action.sa_mask);
+        sigaction(SIGXCPU, &action, &rt_saved_action);
+    }
+    rt_cfg = *cfg;
+    rt_cpu = cpu;
+    __atomic_store_n(&rt_enabled, 1, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&rt_lock);
+    return DHT_SUCCESS;
+}
+
+void dht_rt_disable(void) {
+    pthread_mutex_lock(&rt_lock);
+    if(rt_enabled) {
+        __atomic_store_n(&rt_enabled, 0, __ATOMIC_RELEASE);
+        rt_cpu = -1;
+        setrlimit(RLIMIT_RTTIME, &rt_saved_limit);
+        sigaction(SIGXCPU, &rt_saved_action, NULL);
+        munlockall();
+    }
+    pthread_mutex_unlock(&rt_lock);
+}
+
+int dht_rt_cpu(void) {
+    return __atomic_load_n(&rt_enabled, __ATOMIC_ACQUIRE) ? rt_cpu : -1;
+}
+
+uint64_t dht_rt_overruns(void) {
+    return __atomic_load_n(&rt_overruns, __ATOMIC_RELAXED);
+}
+
+int dht_rt_enter(void) {
+    int priority = sched_get_priority_max(SCHED_FIFO);
+    if(!__atomic_load_n(&rt_enabled, __ATOMIC_ACQUIRE)) { return priority; }
+
+    pthread_mutex_lock(&rt_lock);
+    dht_rt_cfg_t cfg = rt_cfg;
+    int cpu = rt_cpu;
+    pthread_mutex_unlock(&rt_lock);
+
+    if(!rt_prefaulted && cfg.prefault_kb != 0) {
+        dht_rt_prefault(cfg.prefault_kb);
+        rt_prefaulted = 1;
+    }
+
+    // Migrate now rather than in the middle of the capture
+    rt_pinned = 0;
+    if(cpu >= 0 && sched_getaffinity(0, sizeof(rt_affinity), &rt_affinity) == 0) {
+        cpu_set_t one;
+        CPU_ZERO(&one);
+        CPU_SET(cpu, &one);
+        rt_pinned = sched_setaffinity(0, sizeof(one), &one) == 0;
+    }
+
+    // The kernel raises the soft limit each time it fires, set it every time
+    if(cfg.fifo_max_us != 0) {
+        struct rlimit limit;
+        if(getrlimit(RLIMIT_RTTIME, &limit) == 0) {
+            limit.rlim_cur = cfg.fifo_max_us < limit.rlim_max ? cfg.fifo_max_us : limit.rlim_max;
+            setrlimit(RLIMIT_RTTIME, &limit);
+        }
+    }
+
+    return cfg.priority > 0 ? cfg.priority : priority;
+}
+
+void dht_rt_leave(void) {
+    if(rt_pinned) {
+        sched_setaffinity(0, sizeof(rt_affinity), &rt_affinity);
+        rt_pinned = 0;
+    }
+}
+//============================================================================//
@@ -0,0 +1,99 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_rt.h
+ * @version v1.1.0 -- CHANGELOG
+ *                  | v1.0.0 - Added real-time capture mode
+ *                  | v1.1.0 - Mode left off when memory can not be locked
+ *
+ * @note    Once enabled, every set_max_priority() / set_default_priority()
+ *          pair of the readers also:
+ *          - moves the thread to one CPU, an isolcpus one when available, and
+ *            restores its affinity afterwards
+ *          - prefaults the stack of the thread the first time
+ *          - bounds the continuous time at FIFO priority with RLIMIT_RTTIME, a
+ *            thread running over it is dropped to SCHED_OTHER
+ *          and the process memory is locked with mlockall() so no page fault
+ *          lands inside a capture.
+ *
+ *          IRQ affinity is left to the system (e.g. irqaffinity= or
+ *          /proc/irq/N/smp_affinity) together with isolcpus=.
+ *
+ */
+
+#ifndef __DHT_RT_H__
+#define __DHT_RT_H__
+
+//===== INCLUDE ==============================================================//
+#include "dht_common.h"
+//============================================================================//
+
+//===== TYPES, CONSTANTS AND VARIABLES =======================================//
+typedef struct DHT_RT_CFG {
+    int cpu;                                // CPU of the captures, -1 to pick
+    int isolated;                           // Pick from isolcpus first
+    int priority;                           // SCHED_FIFO priority, 0 for max
+    uint32_t fifo_max_us;                   // FIFO time bound, 0 unbounded
+    uint32_t prefault_kb;                   // Stack prefaulted per thread
+} dht_rt_cfg_t;
+//============================================================================//
+
+//===== FUNCTION DECLARATION =================================================//
+/*!
+ * @brief Enables the real-time capture mode
+ * @param [cfg] dht_rt_cfg_t - Settings, NULL for the defaults (picked CPU,
+ *        isolcpus first, max priority, 50 ms bound, 64 KB of stack)
+ * @return 0 if success, DHT_ERR_ARGUMENT for an unusable CPU,
+ *         DHT_ERR_MEMORY if memory could not be locked, the mode stays off
+ *         on either error
+ */
+int dht_rt_enable(const dht_rt_cfg_t *cfg);
+
+/*!
+ * @brief Disables the real-time capture mode and unlocks memory
+ * @param None
+ * @return None
+ */
+void dht_rt_disable(void);
+
+/*!
+ * @brief Get the CPU captures run on
+ * @param None
+ * @return CPU number or -1 when the mode is disabled
+ */
+int dht_rt_cpu(void);
+
+/*!
+ * @brief Get the number of times a thread ran over the FIFO time bound
+ * @param None
+ * @return [uint64_t] Number of overruns
+ */
+uint64_t dht_rt_overruns(void);
+
+/*!
+ * @brief Applies the mode when a thread enters FIFO priority, called by
+ *        set_max_priority()
+ * @param None
+ * @return FIFO priority to use
+ */
+int dht_rt_enter(void);
+
+/*!
+ * @brief Undoes dht_rt_enter() once back at default priority, called by
+ *        set_default_priority()
+ * @param None
+ * @return None
+ */
+void dht_rt_leave(void);
+//============================================================================//
+
+#endif //__DHT_RT_H__
@@ -0,0 +1,195 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_sample.c
+ * @version v1.1.0 -- CHANGELOG
+ *                  | v1.0.0 - Added capture-then-decode sampling
+ *                  | v1.1.0 - First capture sized by a timed burst
+ *
+ * @note    This is a library written in standard C to interface DHT11 sensor
+ *          on beagle bone black
+ *
+ * @sa      doc/DHT11_Technical_Reference.pdf
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <pthread.h>
+#include <string.h>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+#include "dht_decoder.h"
+#include "dht_sample.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+#define DHT_SAMPLE_EDGES        (DHT_RUNS_MAX + 2)
+#define DHT_SAMPLE_BURST        (DHT_SAMPLE_UNROLL * 16)
+
+static uint32_t sample_words[DHT_SAMPLE_WORDS];
+static pthread_mutex_t sample_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// DATAIN reads per millisecond, learned by the first capture, read lock free
+static uint32_t sample_rate = 0;
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+#define DHT_SAMPLE_4(w, i, reg) \
+    (w)[(i) + 0] = *(reg); (w)[(i) + 1] = *(reg); (w)[(i) + 2] = *(reg); (w)[(i) + 3] = *(reg)
+
+static void dht_sample_fill(volatile const uint32_t *reg, uint32_t *words, int n) {
+    // Only the loop branch every DHT_SAMPLE_UNROLL samples
+    for(int i = 0; i < n; i += DHT_SAMPLE_UNROLL) {
+        DHT_SAMPLE_4(words, i + 0, reg);
+        DHT_SAMPLE_4(words, i + 4, reg);
+        DHT_SAMPLE_4(words, i + 8, reg);
+        DHT_SAMPLE_4(words, i + 12, reg);
+    }
+}
+
+static void dht_sample_fill_spread(volatile const uint32_t *reg, uint32_t *words, int n, int stride) {
+    // Same spacing for every sample, the extra reads are thrown away
+    for(int i = 0; i < n; i++) {
+        uint32_t word = 0;
+        for(int s = 0; s < stride; s++) { word = *reg; }
+        words[i] = word;
+    }
+}
+
+static int dht_sample_scan(const uint32_t *words, int from, int to, uint32_t mask, uint32_t *edges,
+    int count, int max) {
+    for(int i = from; i < to && count < max; i++) {
+        if((words[i] ^ words[i - 1]) & mask) { edges[count++] = (uint32_t) i; }
+    }
+    return count;
+}
+
+int dht_sample_edges(const uint32_t *words, int n, uint32_t mask, uint32_t *edges, int max) {
+    int count = 0;
+    int i = 1;
+
+    // Levels last dozens of samples, most blocks of 8 hold no edge and are
+    // passed over with one test
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    const uint32x4_t bit = vdupq_n_u32(mask);
+    for(; i + 8 <= n && count < max; i += 8) {
+        uint32x4_t x0 = veorq_u32(vld1q_u32(words + i), vld1q_u32(words + i - 1));
+        uint32x4_t x1 = veorq_u32(vld1q_u32(words + i + 4), vld1q_u32(words + i + 3));
+        uint32x4_t x = vandq_u32(vorrq_u32(x0, x1), bit);
+        uint32x2_t r = vorr_u32(vget_low_u32(x), vget_high_u32(x));
+        if((vget_lane_u32(r, 0) | vget_lane_u32(r, 1)) == 0) { continue; }
+        count = dht_sample_scan(words, i, i + 8, mask, edges, count, max);
+    }
+#else
+    for(; i + 8 <= n && count < max; i += 8) {
+        uint32_t x = (words[i + 0] ^ words[i - 1]) | (words[i + 1] ^ words[i + 0]) |
+                     (words[i + 2] ^ words[i + 1]) | (words[i + 3] ^ words[i + 2]) |
+                     (words[i + 4] ^ words[i + 3]) | (words[i + 5] ^ words[i + 4]) |
+                     (words[i + 6] ^ words[i + 5]) | (words[i + 7] ^ words[i + 6]);
+        if((x & mask) == 0) { continue; }
+        count = dht_sample_scan(words, i, i + 8, mask, edges, count, max);
+    }
+#endif
+
+    return dht_sample_scan(words, i, n, mask, edges, count, max);
+}
+
+int dht_sample_widths(const uint32_t *words, uint32_t mask, const uint32_t *edges, int count,
+    float ns_per_sample, uint32_t *widths) {
+    const float us_per_sample = ns_per_sample / 1000.0f;
+
+    // The line idles high, the response starts at the first falling edge
+    int first = 0;
+    while(first < count && (words[edges[first]] & mask)) { first++; }
+    if(first == count || (float) edges[first] * us_per_sample > (float) DHT_RESPONSE_TIMEOUT_US) { return -1; }
+
+    int n = 0;
+    for(int e = first; e + 1 < count && n < DHT_RUNS_MAX; e++) {
+        uint32_t width = (uint32_t) ((float) (edges[e + 1] - edges[e]) * us_per_sample + 0.5f);
+        if(width >= DHT_PULSE_TIMEOUT_US) { break; }
+        widths[n++] = width;
+    }
+    return n;
+}
+
+static int dht_sample_size(uint64_t rate, int *stride) {
+    // Enough samples for the window, spread out once that is more than the
+    // buffer holds
+    uint64_t needed = rate * DHT_SAMPLE_WINDOW_US / 1000;
+    if(needed < DHT_SAMPLE_BURST) { needed = DHT_SAMPLE_BURST; }
+    *stride = (int) ((needed + DHT_SAMPLE_WORDS - 1) / DHT_SAMPLE_WORDS);
+    uint64_t n = (needed / *stride + DHT_SAMPLE_UNROLL - 1) / DHT_SAMPLE_UNROLL * DHT_SAMPLE_UNROLL;
+    return n > DHT_SAMPLE_WORDS ? DHT_SAMPLE_WORDS : (int) n;
+}
+
+int dht_sample_capture(gpio_t pin, uint32_t *pulses, int *count) {
+    memset(pulses, 0, DHT_RUNS_MAX * sizeof(uint32_t));
+    *count = 0;
+
+    pthread_mutex_lock(&sample_lock);
+
+    volatile const uint32_t *reg = &pin.base[MMIO_IO_DATAIN / 4];
+    const uint32_t tpus = dht_ticks_per_us();
+    uint64_t rate = sample_rate;
+    int head = 0;
+    int reads = 0;
+    int stride;
+
+    uint32_t start = dht_ticks();
+    if(rate == 0) {
+        // The first capture times a short burst to size its window
+        dht_sample_fill(reg, sample_words, DHT_SAMPLE_BURST);
+        uint32_t ticks = dht_ticks() - start;
+        rate = (uint64_t) DHT_SAMPLE_BURST * 1000ULL * tpus / (ticks != 0 ? ticks : 1);
+        reads = DHT_SAMPLE_BURST;
+    }
+
+    int n = dht_sample_size(rate, &stride);
+    if(reads != 0) {
+        // The burst stays the head of the window at the spacing of the rest
+        head = DHT_SAMPLE_BURST / stride;
+        for(int i = 1; stride > 1 && i < head; i++) { sample_words[i] = sample_words[i * stride]; }
+    }
+    if(stride == 1) {
+        dht_sample_fill(reg, sample_words + head, n - head);
+    } else {
+        dht_sample_fill_spread(reg, sample_words + head, n - head, stride);
+    }
+    reads += (n - head) * stride;
+    uint32_t ticks = dht_ticks() - start;
+
+    // The rate counts the reads thrown away by a spread capture too
+    const float ns_per_sample = (float) ticks * 1000.0f / (float) tpus / (float) reads * (float) stride;
+    if(ticks != 0) {
+        rate = (uint64_t) reads * 1000ULL * tpus / ticks;
+        __atomic_store_n(&sample_rate, rate > UINT32_MAX ? UINT32_MAX : (uint32_t) rate, __ATOMIC_RELAXED);
+    }
+
+    uint32_t edges[DHT_SAMPLE_EDGES];
+    const uint32_t mask = 1u << pin.num;
+    int found = dht_sample_edges(sample_words, n, mask, edges, DHT_SAMPLE_EDGES);
+    int widths = dht_sample_widths(sample_words, mask, edges, found, ns_per_sample, pulses);
+
+    pthread_mutex_unlock(&sample_lock);
+
+    if(widths < 0) { return DHT_ERR_TIMEOUT; }
+    *count = widths;
+    return widths >= (int) DHT_PULSES * 2 ? DHT_SUCCESS : DHT_ERR_TIMEOUT;
+}
+
+uint32_t dht_sample_rate(void) {
+    return __atomic_load_n(&sample_rate, __ATOMIC_RELAXED);
+}
+//============================================================================//
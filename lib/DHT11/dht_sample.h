@@ -0,0 +1,103 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_sample.h
+ * @version v1.1.0 -- CHANGELOG
+ *                  | v1.0.0 - Added capture-then-decode sampling
+ *                  | v1.1.0 - First capture sized by a timed burst
+ *
+ * @note    DHT_CAPTURE_SAMPLE stores raw MMIO_IO_DATAIN words for a fixed
+ *          window and finds the edges afterwards. The sampling loop is
+ *          unrolled straight-line loads and stores without compares, so
+ *          samples are as close and as evenly spaced as the interconnect
+ *          allows. The sample period is the window time over the samples
+ *          taken.
+ *
+ *          Edges are extracted from the words with NEON where the library is
+ *          built for it (DHT_USE_NEON), otherwise with a scalar loop that
+ *          skips blocks without a transition the same way.
+ *
+ *          The first capture times a short burst of reads to learn the
+ *          sampling rate and keeps it as the head of its window, every
+ *          capture takes just enough samples for the window. Reads
+ *          faster than the buffer holds are spread with extra reads between
+ *          stored samples. One capture runs at a time, the buffer is shared.
+ *
+ * @sa      doc/DHT11_Technical_Reference.pdf
+ *
+ */
+
+#ifndef __DHT_SAMPLE_H__
+#define __DHT_SAMPLE_H__
+
+//===== INCLUDE ==============================================================//
+#include "dht_common.h"
+#include "mmio.h"
+//============================================================================//
+
+//===== TYPES, CONSTANTS AND VARIABLES =======================================//
+#define DHT_SAMPLE_WORDS        65536
+#define DHT_SAMPLE_UNROLL       16
+
+// Start of the response, preamble and 40 bits of at most 120us each
+static const uint32_t DHT_SAMPLE_WINDOW_US      = 6000;
+//============================================================================//
+
+//===== FUNCTION DECLARATION =================================================//
+/*!
+ * @brief Samples the line for the window after the start signal and measures
+ *        the widths of the response levels until the line rests
+ * @param [pin] gpio_t - Pin of the sensor, already set as input
+ * @param [pulses] uint32_t - Output of DHT_RUNS_MAX pulse widths in
+ *        microseconds
+ * @param [count] int - Output of the number of widths measured
+ * @return 0 if success else DHT_ERR_TIMEOUT if fewer than DHT_PULSES * 2
+ */
+int dht_sample_capture(gpio_t pin, uint32_t *pulses, int *count);
+
+/*!
+ * @brief Finds the samples at which the pin changed level
+ * @param [words] uint32_t - Sampled DATAIN words
+ * @param [n] int - Number of words
+ * @param [mask] uint32_t - Bit of the pin
+ * @param [edges] uint32_t - Output of the indices of the first sample of
+ *        each new level
+ * @param [max] int - Room in edges
+ * @return [int] Number of edges found, at most max
+ */
+int dht_sample_edges(const uint32_t *words, int n, uint32_t mask, uint32_t *edges, int max);
+
+/*!
+ * @brief Turns edges into the level widths dht_decode_frame() expects,
+ *        starting with the first low level and ending at the first level
+ *        that lasts DHT_PULSE_TIMEOUT_US or at the last edge
+ * @param [words] uint32_t - Sampled DATAIN words the edges were found in
+ * @param [mask] uint32_t - Bit of the pin
+ * @param [edges] uint32_t - Edges from dht_sample_edges()
+ * @param [count] int - Number of edges
+ * @param [ns_per_sample] float - Sample period
+ * @param [widths] uint32_t - Output of DHT_RUNS_MAX widths in microseconds
+ * @return [int] Number of widths, -1 if the response did not start within
+ *         DHT_RESPONSE_TIMEOUT_US
+ */
+int dht_sample_widths(const uint32_t *words, uint32_t mask, const uint32_t *edges, int count,
+    float ns_per_sample, uint32_t *widths);
+
+/*!
+ * @brief Get the sampling rate measured by the last capture
+ * @param None
+ * @return [uint32_t] DATAIN reads per millisecond, 0 before the first
+ */
+uint32_t dht_sample_rate(void);
+//============================================================================//
+
+#endif //__DHT_SAMPLE_H__
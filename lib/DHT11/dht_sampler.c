@@ -0,0 +1,170 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_sampler.c
+ * @version v1.1.1 -- CHANGELOG
+ *                  | v1.0.0 - Added background sampler with seqlock snapshot
+ *                  | v1.1.0 - Published filtered readings next to the raw ones
+ *                  | v1.1.1 - Stop after a failed start or a stop is a no-op
+ *
+ * @note    This is a library written in standard C to sample a DHT sensor in
+ *          the background on beagle bone black
+ *
+ * @sa      doc/DHT11_Technical_Reference.pdf
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+
+#include "dht_sampler.h"
+#include "dht11.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static uint64_t dht_sampler_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void dht_sampler_publish(dht_sampler_t *sampler, const dht_sample_t *sample) {
+    uint32_t seq = __atomic_load_n(&sampler->seq, __ATOMIC_RELAXED);
+
+    __atomic_store_n(&sampler->seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    memcpy(&sampler->sample, sample, sizeof(*sample));
+    __atomic_store_n(&sampler->seq, seq + 2, __ATOMIC_RELEASE);
+}
+
+static void *dht_sampler_run(void *arg) {
+    dht_sampler_t *sampler = (dht_sampler_t *) arg;
+    dht_sample_t sample;
+    memset(&sample, 0, sizeof(sample));
+
+    struct timespec next;
+    clock_gettime(CLOCK_MONOTONIC, &next);
+
+    pthread_mutex_lock(&sampler->lock);
+    while(sampler->running) {
+        pthread_mutex_unlock(&sampler->lock);
+
+        float humidity = 0.0f;
+        float temperature = 0.0f;
+        int result = dht_read(sampler->type, sampler->base, sampler->num, &humidity, &temperature);
+
+        // Failed reads keep the last good values and report the error
+        sample.status = result;
+        sample.reads++;
+        sample.time_ns = dht_sampler_now();
+        if(result == DHT_SUCCESS) {
+            sample.humidity = humidity;
+            sample.temperature = temperature;
+            sample.good_ns = sample.time_ns;
+            sample.filtered_humidity = dht_filter_update(&sampler->humidity_filter, humidity, sample.time_ns);
+            sample.filtered_temperature = dht_filter_update(&sampler->temperature_filter, temperature,
+                sample.time_ns);
+        }
+        dht_sampler_publish(sampler, &sample);
+
+        // Fixed cadence measured from the start of each read
+        next.tv_sec += sampler->period_ms / 1000;
+        next.tv_nsec += (sampler->period_ms % 1000) * 1000000L;
+        if(next.tv_nsec >= 1000000000L) {
+            next.tv_sec++;
+            next.tv_nsec -= 1000000000L;
+        }
+
+        pthread_mutex_lock(&sampler->lock);
+        while(sampler->running &&
+              pthread_cond_timedwait(&sampler->wake, &sampler->lock, &next) != ETIMEDOUT);
+
+        // Do not try to catch up after a long read, start over from now
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        if(now.tv_sec > next.tv_sec || (now.tv_sec == next.tv_sec && now.tv_nsec > next.tv_nsec)) {
+            next = now;
+        }
+    }
+    pthread_mutex_unlock(&sampler->lock);
+
+    return NULL;
+}
+
+int dht_sampler_start(dht_sampler_t *sampler, int type, int base, int num, uint32_t period_ms) {
+    if(sampler == NULL) { return DHT_ERR_ARGUMENT; }
+
+    // A sampler that failed to start is left stopped
+    memset(sampler, 0, sizeof(*sampler));
+    if(base < 0 || base > 3 || num < 0 || num > 31) { return DHT_ERR_ARGUMENT; }
+
+    sampler->type = type;
+    sampler->base = base;
+    sampler->num = num;
+    sampler->period_ms = period_ms;
+    dht_filter_init(&sampler->humidity_filter, &DHT_FILTER_HUMIDITY);
+    dht_filter_init(&sampler->temperature_filter, &DHT_FILTER_TEMPERATURE);
+    sampler->running = 1;
+
+    // Timed waits follow the monotonic clock like the read timestamps
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&sampler->wake, &attr);
+    pthread_condattr_destroy(&attr);
+    pthread_mutex_init(&sampler->lock, NULL);
+
+    if(pthread_create(&sampler->thread, NULL, dht_sampler_run, sampler) != 0) {
+        pthread_cond_destroy(&sampler->wake);
+        pthread_mutex_destroy(&sampler->lock);
+        sampler->running = 0;
+        return DHT_ERR_ARGUMENT;
+    }
+
+    sampler->started = 1;
+    return DHT_SUCCESS;
+}
+
+void dht_sampler_stop(dht_sampler_t *sampler) {
+    // The lock is destroyed by the stop, only the flag is safe to test
+    if(sampler == NULL || !sampler->started) { return; }
+    sampler->started = 0;
+
+    pthread_mutex_lock(&sampler->lock);
+    sampler->running = 0;
+    pthread_cond_signal(&sampler->wake);
+    pthread_mutex_unlock(&sampler->lock);
+
+    pthread_join(sampler->thread, NULL);
+    pthread_cond_destroy(&sampler->wake);
+    pthread_mutex_destroy(&sampler->lock);
+}
+
+int dht_sampler_latest(const dht_sampler_t *sampler, dht_sample_t *sample) {
+    if(sampler == NULL || sample == NULL) { return DHT_ERR_ARGUMENT; }
+
+    uint32_t begin, end;
+    do {
+        begin = __atomic_load_n(&sampler->seq, __ATOMIC_ACQUIRE);
+        memcpy(sample, &sampler->sample, sizeof(*sample));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        end = __atomic_load_n(&sampler->seq, __ATOMIC_RELAXED);
+    } while((begin & 1) || begin != end);
+
+    return begin == 0 ? DHT_ERR_TIMEOUT : DHT_SUCCESS;
+}
+//============================================================================//
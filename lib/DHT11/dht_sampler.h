@@ -0,0 +1,105 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_sampler.h
+ * @version v1.1.1 -- CHANGELOG
+ *                  | v1.0.0 - Added background sampler with seqlock snapshot
+ *                  | v1.1.0 - Published filtered readings next to the raw ones
+ *                  | v1.1.1 - Stop after a failed start or a stop is a no-op
+ *
+ * @note    The sampler owns one sensor on its own thread and publishes every
+ *          result through a seqlock. Readers copy the latest sample without
+ *          locks or syscalls and never wait on the sensor.
+ *
+ * @sa      doc/DHT11_Technical_Reference.pdf
+ *
+ */
+
+#ifndef __DHT_SAMPLER_H__
+#define __DHT_SAMPLER_H__
+
+//===== INCLUDE ==============================================================//
+#include <pthread.h>
+#include <stdint.h>
+
+#include "dht_common.h"
+#include "dht_filter.h"
+//============================================================================//
+
+//===== TYPES, CONSTANTS AND VARIABLES =======================================//
+typedef struct DHT_SAMPLE {
+    float humidity;             // Last good humidity
+    float temperature;          // Last good temperature
+    float filtered_humidity;    // Good humidity readings through the filters
+    float filtered_temperature;
+    int status;                 // dht_err_e result of the latest read
+    uint32_t reads;             // Reads done since start
+    uint64_t time_ns;           // CLOCK_MONOTONIC time of the latest read
+    uint64_t good_ns;           // CLOCK_MONOTONIC time of the last good read
+} dht_sample_t;
+
+typedef struct DHT_SAMPLER {
+    int type;
+    int base;
+    int num;
+    uint32_t period_ms;
+    dht_filter_t humidity_filter;
+    dht_filter_t temperature_filter;
+
+    // Sampler thread and its wake up for stop requests
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    int running;
+    int started;                // Thread, lock and wake alive, owner only
+
+    // Seqlock protected snapshot, odd sequence while being written
+    uint32_t seq;
+    dht_sample_t sample;
+} dht_sampler_t;
+//============================================================================//
+
+//===== FUNCTION DECLARATION =================================================//
+/*!
+ * @brief Starts a thread reading the sensor at a fixed cadence
+ * @param [sampler] dht_sampler_t - Sampler to start
+ * @param [type] int - Type of sensor i.e. DHT11, DHT22 etc.
+ * @param [base] int - Gpio base where the sensor is connected (0..3)
+ * @param [num] int - GPIO pin number where the sensor is connected (0..31)
+ * @param [period_ms] uint32_t - Time between the start of two reads
+ * @return 0 if success else negative values for various possible errors
+ *
+ * @note A read takes about 520 ms, shorter periods read back to back. Good
+ *       readings are filtered with DHT_FILTER_HUMIDITY and
+ *       DHT_FILTER_TEMPERATURE.
+ */
+int dht_sampler_start(dht_sampler_t *sampler, int type, int base, int num, uint32_t period_ms);
+
+/*!
+ * @brief Stops the sampler thread, waiting for a read in progress to finish.
+ *        Does nothing for a sampler that failed to start or is stopped.
+ * @param [sampler] dht_sampler_t - Sampler to stop
+ * @return None
+ */
+void dht_sampler_stop(dht_sampler_t *sampler);
+
+/*!
+ * @brief Copies the latest published sample. Lock free and without syscalls,
+ *        safe to call from any number of threads.
+ * @param [sampler] dht_sampler_t - Sampler to read
+ * @param [sample] dht_sample_t - Output of the latest sample
+ * @return 0 if a read has been published else DHT_ERR_TIMEOUT
+ */
+int dht_sampler_latest(const dht_sampler_t *sampler, dht_sample_t *sample);
+//============================================================================//
+
+#endif //__DHT_SAMPLER_H__
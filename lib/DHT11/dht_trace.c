@@ -0,0 +1,197 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_trace.c
+ * @version v1.1.0 -- CHANGELOG
+ *                  | v1.0.0 - Added raw capture trace recorder
+ *                  | v1.0.1 - dht_err_e codes on every error path
+ *                  | v1.1.0 - Width unit of each record and loop calibration
+ *
+ * @note    This is a library written in standard C to interface DHT11 sensor
+ *          on beagle bone black
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <fcntl.h>
+#include <pthread.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "dht_calibrate.h"
+#include "dht_trace.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+static const uint32_t DHT_TRACE_MAGIC = 0x54544844;     // "DHTT"
+static const uint16_t DHT_TRACE_VERSION = 2;
+
+static pthread_mutex_t trace_lock = PTHREAD_MUTEX_INITIALIZER;
+static int trace_fd = -1;
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static uint64_t dht_trace_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static int dht_trace_valid(const dht_trace_header_t *header) {
+    return header->magic == DHT_TRACE_MAGIC && header->version == DHT_TRACE_VERSION &&
+        header->record_size == sizeof(dht_trace_record_t);
+}
+
+int dht_trace_open(const char *path) {
+    if(path == NULL) { return DHT_ERR_ARGUMENT; }
+
+    int fd = open(path, O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if(fd < 0) { return DHT_ERR_FILE; }
+
+    struct stat st;
+    if(fstat(fd, &st) < 0) {
+        close(fd);
+        return DHT_ERR_FILE;
+    }
+
+    dht_trace_header_t header;
+    if(st.st_size == 0) {
+        memset(&header, 0, sizeof(header));
+        header.magic = DHT_TRACE_MAGIC;
+        header.version = DHT_TRACE_VERSION;
+        header.record_size = sizeof(dht_trace_record_t);
+        header.loops_per_ms = dht_loops_per_ms();
+        header.created_ns = dht_trace_now_ns();
+        if(write(fd, &header, sizeof(header)) != sizeof(header)) {
+            close(fd);
+            return DHT_ERR_FILE;
+        }
+    } else {
+        ssize_t got = pread(fd, &header, sizeof(header), 0);
+        if(got < 0) {
+            close(fd);
+            return DHT_ERR_FILE;
+        }
+        if(got != sizeof(header) || !dht_trace_valid(&header)) {
+            close(fd);
+            return DHT_ERR_FORMAT;
+        }
+
+        // Drop a record cut short by a crash so the next one stays aligned
+        off_t records = (st.st_size - (off_t) sizeof(header)) / (off_t) sizeof(dht_trace_record_t);
+        if(ftruncate(fd, (off_t) sizeof(header) + records * (off_t) sizeof(dht_trace_record_t)) < 0) {
+            close(fd);
+            return DHT_ERR_FILE;
+        }
+    }
+
+    pthread_mutex_lock(&trace_lock);
+    if(trace_fd >= 0) { close(trace_fd); }
+    __atomic_store_n(&trace_fd, fd, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&trace_lock);
+    return DHT_SUCCESS;
+}
+
+void dht_trace_close(void) {
+    pthread_mutex_lock(&trace_lock);
+    if(trace_fd >= 0) {
+        close(trace_fd);
+        __atomic_store_n(&trace_fd, -1, __ATOMIC_RELEASE);
+    }
+    pthread_mutex_unlock(&trace_lock);
+}
+
+void dht_trace_record(int type, int base, int num, dht_capture_e mode, int status,
+    const uint32_t *widths, int count) {
+    // Readers pay a single load when nothing is recorded
+    if(__atomic_load_n(&trace_fd, __ATOMIC_ACQUIRE) < 0) { return; }
+
+    dht_trace_record_t record;
+    memset(&record, 0, sizeof(record));
+    record.time_ns = dht_trace_now_ns();
+    record.type = (uint8_t) type;
+    record.base = (uint8_t) base;
+    record.num = (uint8_t) num;
+    record.mode = (uint8_t) mode;
+    record.status = (int8_t) status;
+
+    // The unit dht_decode() judged the widths in
+    record.unit = 1;
+    if(mode == DHT_CAPTURE_COUNT) {
+        uint32_t loops_per_us = dht_loops_per_ms() / 1000;
+        record.unit = dht_loops_per_ms() == 0 ? 0 : loops_per_us == 0 ? 1 :
+            loops_per_us > UINT16_MAX ? UINT16_MAX : (uint16_t) loops_per_us;
+    }
+
+    if(widths == NULL || count < 0) { count = 0; }
+    if(count > DHT_RUNS_MAX) { count = DHT_RUNS_MAX; }
+    record.count = (uint8_t) count;
+    for(int i = 0; i < count; i++) {
+        record.widths[i] = widths[i] > UINT16_MAX ? UINT16_MAX : (uint16_t) widths[i];
+    }
+
+    pthread_mutex_lock(&trace_lock);
+    if(trace_fd >= 0 && write(trace_fd, &record, sizeof(record)) != sizeof(record)) {
+        // Out of space, stop rather than leave misaligned records behind
+        close(trace_fd);
+        __atomic_store_n(&trace_fd, -1, __ATOMIC_RELEASE);
+    }
+    pthread_mutex_unlock(&trace_lock);
+}
+
+int dht_trace_map(const char *path, dht_trace_t *trace) {
+    if(path == NULL || trace == NULL) { return DHT_ERR_ARGUMENT; }
+    memset(trace, 0, sizeof(*trace));
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if(fd < 0) { return DHT_ERR_FILE; }
+
+    struct stat st;
+    if(fstat(fd, &st) < 0) {
+        close(fd);
+        return DHT_ERR_FILE;
+    }
+    if((size_t) st.st_size < sizeof(dht_trace_header_t)) {
+        close(fd);
+        return DHT_ERR_FORMAT;
+    }
+
+    void *map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if(map == MAP_FAILED) { return DHT_ERR_FILE; }
+
+    const dht_trace_header_t *header = (const dht_trace_header_t *) map;
+    if(!dht_trace_valid(header)) {
+        munmap(map, st.st_size);
+        return DHT_ERR_FORMAT;
+    }
+
+    // Frames are read in order, let the kernel read ahead
+    madvise(map, st.st_size, MADV_SEQUENTIAL);
+
+    trace->header = header;
+    trace->records = (const dht_trace_record_t *) (header + 1);
+    trace->count = (st.st_size - sizeof(*header)) / sizeof(dht_trace_record_t);
+    trace->size = st.st_size;
+    return DHT_SUCCESS;
+}
+
+void dht_trace_unmap(dht_trace_t *trace) {
+    if(trace == NULL || trace->header == NULL) { return; }
+
+    munmap((void *) trace->header, trace->size);
+    memset(trace, 0, sizeof(*trace));
+}
+//============================================================================//
@@ -0,0 +1,121 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_trace.h
+ * @version v1.1.0 -- CHANGELOG
+ *                  | v1.0.0 - Added raw capture trace recorder
+ *                  | v1.0.1 - dht_err_e codes on every error path
+ *                  | v1.1.0 - Width unit of each record and loop calibration
+ *
+ * @note    When enabled, every capture is appended to a trace file as it was
+ *          seen: the level widths, their unit and the live decode result. The
+ *          file is a 32 byte header followed by fixed size records, so it can
+ *          be mapped and indexed directly. A record cut short by a crash at
+ *          the end of the file is ignored by dht_trace_map().
+ *
+ *          Widths are microseconds for time, event and sample captures and
+ *          polling loop iterations for count captures. Each record keeps the
+ *          unit the live read decoded with, loops per microsecond of the
+ *          calibration at the time, so a replay judges them the same way.
+ *
+ */
+
+#ifndef __DHT_TRACE_H__
+#define __DHT_TRACE_H__
+
+//===== INCLUDE ==============================================================//
+#include <stddef.h>
+
+#include "dht_common.h"
+#include "dht_decoder.h"
+//============================================================================//
+
+//===== TYPES, CONSTANTS AND VARIABLES =======================================//
+typedef struct DHT_TRACE_HEADER {
+    uint32_t magic;                         // "DHTT"
+    uint16_t version;
+    uint16_t record_size;
+    uint32_t loops_per_ms;                  // Calibration at creation, 0 if none
+    uint32_t reserved;
+    uint64_t created_ns;                    // CLOCK_REALTIME of creation
+    uint64_t reserved2;
+} dht_trace_header_t;
+
+typedef struct DHT_TRACE_RECORD {
+    uint64_t time_ns;                       // CLOCK_REALTIME of the capture
+    uint8_t type;                           // DHT11, DHT22
+    uint8_t base;
+    uint8_t num;
+    uint8_t mode;                           // dht_capture_e of the widths
+    int8_t status;                          // dht_err_e of the live read
+    uint8_t count;                          // Widths captured
+    uint16_t unit;                          // Widths per us, 0 if unknown
+    uint16_t widths[DHT_RUNS_MAX];          // Saturated at 65535
+} dht_trace_record_t;
+
+typedef struct DHT_TRACE {
+    const dht_trace_header_t *header;
+    const dht_trace_record_t *records;
+    size_t count;
+    size_t size;
+} dht_trace_t;
+//============================================================================//
+
+//===== FUNCTION DECLARATION =================================================//
+/*!
+ * @brief Starts recording every capture to a trace file, appending to it if
+ *        it already holds a trace
+ * @param [path] char - Trace file
+ * @return 0 if success, DHT_ERR_FILE if it can not be opened or written,
+ *         DHT_ERR_FORMAT if it holds something other than a trace
+ */
+int dht_trace_open(const char *path);
+
+/*!
+ * @brief Stops recording and closes the trace file
+ * @param None
+ * @return None
+ */
+void dht_trace_close(void);
+
+/*!
+ * @brief Appends a capture to the trace, does nothing unless recording
+ * @param [type] int - Type of sensor i.e. DHT11, DHT22 etc.
+ * @param [base] int - Gpio base of the sensor (0..3)
+ * @param [num] int - GPIO number of the sensor (0..31)
+ * @param [mode] dht_capture_e - Unit of the widths
+ * @param [status] int - dht_err_e of the read
+ * @param [widths] uint32_t - Captured level widths
+ * @param [count] int - Number of widths
+ * @return None
+ */
+void dht_trace_record(int type, int base, int num, dht_capture_e mode, int status,
+    const uint32_t *widths, int count);
+
+/*!
+ * @brief Maps a trace file read only
+ * @param [path] char - Trace file
+ * @param [trace] dht_trace_t - Output of the mapped trace
+ * @return 0 if success, DHT_ERR_FILE if it can not be opened or mapped,
+ *         DHT_ERR_FORMAT if it holds something other than a trace
+ */
+int dht_trace_map(const char *path, dht_trace_t *trace);
+
+/*!
+ * @brief Unmaps a trace file
+ * @param [trace] dht_trace_t - Trace to unmap
+ * @return None
+ */
+void dht_trace_unmap(dht_trace_t *trace);
+//============================================================================//
+
+#endif //__DHT_TRACE_H__
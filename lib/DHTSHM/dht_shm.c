@@ -0,0 +1,191 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_shm.c
+ * @version v1.0.2 -- CHANGELOG
+ *                  | v1.0.0 - Added shared memory publication of readings
+ *                  | v1.0.1 - Segment of a running publisher not replaced
+ *                  | v1.0.2 - Publisher holds a lock on the segment
+ *
+ * @note    This is a library written in standard C to share DHT readings
+ *          with other processes
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "dht_shm.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static int dht_shm_name(dht_shm_t *shm, const char *name) {
+    memset(shm, 0, sizeof(*shm));
+    if(name == NULL) { name = DHT_SHM_NAME; }
+    if(name[0] != '/' || strlen(name) >= sizeof(shm->name)) { return DHT_SHM_ERR_ARG; }
+    strcpy(shm->name, name);
+    return DHT_SHM_SUCCESS;
+}
+
+static int dht_shm_lock(const char *name) {
+    for(;;) {
+        int fd = shm_open(name, O_CREAT | O_RDWR | O_CLOEXEC, 0644);
+        if(fd < 0) { return DHT_SHM_ERR_FILE; }
+
+        // The publisher holds the lock until it closes or dies, so only a
+        // segment nobody publishes to is taken
+        if(flock(fd, LOCK_EX | LOCK_NB) != 0) {
+            int busy = errno == EWOULDBLOCK;
+            close(fd);
+            return busy ? DHT_SHM_ERR_BUSY : DHT_SHM_ERR_FILE;
+        }
+
+        // Another creator may have replaced the segment before it was locked
+        struct stat locked, linked;
+        int current = fstat(fd, &locked) == 0;
+        int check = shm_open(name, O_RDONLY | O_CLOEXEC, 0);
+        if(check >= 0) {
+            current = current && fstat(check, &linked) == 0 &&
+                locked.st_dev == linked.st_dev && locked.st_ino == linked.st_ino;
+            close(check);
+        } else {
+            current = 0;
+        }
+
+        // An empty segment was just created, by this call or by one that
+        // lost the lock. One with contents was left by a dead publisher and
+        // is replaced, clients still mapping it keep it until they reopen.
+        if(current && locked.st_size == 0) { return fd; }
+        if(current) { shm_unlink(name); }
+        close(fd);
+    }
+}
+
+int dht_shm_create(dht_shm_t *shm, const char *name) {
+    if(shm == NULL || dht_shm_name(shm, name) != DHT_SHM_SUCCESS) { return DHT_SHM_ERR_ARG; }
+
+    int fd = dht_shm_lock(shm->name);
+    if(fd < 0) { return fd; }
+    if(ftruncate(fd, sizeof(dht_shm_segment_t)) < 0) {
+        shm_unlink(shm->name);
+        close(fd);
+        return DHT_SHM_ERR_FILE;
+    }
+
+    void *map = mmap(NULL, sizeof(dht_shm_segment_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if(map == MAP_FAILED) {
+        shm_unlink(shm->name);
+        close(fd);
+        return DHT_SHM_ERR_FILE;
+    }
+
+    // The segment starts zeroed, every slot reads as not published yet
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    shm->seg = map;
+    shm->fd = fd;
+    shm->owner = 1;
+    shm->seg->version = DHT_SHM_VERSION;
+    shm->seg->sensors = DHT_SHM_SENSORS;
+    shm->seg->size = sizeof(dht_shm_segment_t);
+    shm->seg->pid = (int32_t) getpid();
+    shm->seg->start_ns = (uint64_t) now.tv_sec * 1000000000ULL + (uint64_t) now.tv_nsec;
+    for(int i = 0; i < DHT_SHM_SENSORS; i++) { shm->seg->slot[i].sensor = (uint32_t) i; }
+    __atomic_store_n(&shm->seg->magic, DHT_SHM_MAGIC, __ATOMIC_RELEASE);
+
+    return DHT_SHM_SUCCESS;
+}
+
+int dht_shm_publish(dht_shm_t *shm, int sensor, const dht_shm_reading_t *reading) {
+    if(shm == NULL || shm->seg == NULL || !shm->owner || reading == NULL) { return DHT_SHM_ERR_ARG; }
+    if(sensor < 0 || sensor >= DHT_SHM_SENSORS) { return DHT_SHM_ERR_ARG; }
+
+    dht_shm_slot_t *slot = &shm->seg->slot[sensor];
+    uint32_t seq = __atomic_load_n(&slot->seq, __ATOMIC_RELAXED);
+
+    __atomic_store_n(&slot->seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    memcpy(&slot->reading, reading, sizeof(*reading));
+    __atomic_store_n(&slot->seq, seq + 2, __ATOMIC_RELEASE);
+
+    return DHT_SHM_SUCCESS;
+}
+
+int dht_shm_open(dht_shm_t *shm, const char *name) {
+    if(shm == NULL || dht_shm_name(shm, name) != DHT_SHM_SUCCESS) { return DHT_SHM_ERR_ARG; }
+
+    int fd = shm_open(shm->name, O_RDONLY | O_CLOEXEC, 0);
+    if(fd < 0) { return DHT_SHM_ERR_FILE; }
+
+    // A segment still being set up is shorter or has no magic yet
+    struct stat st;
+    if(fstat(fd, &st) < 0 || (size_t) st.st_size < sizeof(dht_shm_segment_t)) {
+        close(fd);
+        return DHT_SHM_ERR_FORMAT;
+    }
+
+    void *map = mmap(NULL, sizeof(dht_shm_segment_t), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if(map == MAP_FAILED) { return DHT_SHM_ERR_FILE; }
+
+    const dht_shm_segment_t *seg = map;
+    if(__atomic_load_n(&seg->magic, __ATOMIC_ACQUIRE) != DHT_SHM_MAGIC || seg->version != DHT_SHM_VERSION ||
+       seg->size != sizeof(dht_shm_segment_t)) {
+        munmap(map, sizeof(dht_shm_segment_t));
+        return DHT_SHM_ERR_FORMAT;
+    }
+
+    shm->seg = map;
+    return DHT_SHM_SUCCESS;
+}
+
+int dht_shm_read(const dht_shm_t *shm, int sensor, dht_shm_reading_t *reading) {
+    if(shm == NULL || shm->seg == NULL || reading == NULL) { return DHT_SHM_ERR_ARG; }
+    if(sensor < 0 || sensor >= DHT_SHM_SENSORS) { return DHT_SHM_ERR_ARG; }
+
+    const dht_shm_slot_t *slot = &shm->seg->slot[sensor];
+    uint32_t begin, end;
+    int retries = 0;
+    do {
+        // A publisher killed inside a write leaves the sequence odd for good
+        if(retries++ == DHT_SHM_RETRIES) { return DHT_SHM_ERR_BUSY; }
+        begin = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+        memcpy(reading, &slot->reading, sizeof(*reading));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        end = __atomic_load_n(&slot->seq, __ATOMIC_RELAXED);
+    } while((begin & 1) || begin != end);
+
+    return begin == 0 ? DHT_SHM_ERR_EMPTY : DHT_SHM_SUCCESS;
+}
+
+void dht_shm_close(dht_shm_t *shm) {
+    if(shm == NULL || shm->seg == NULL) { return; }
+
+    munmap(shm->seg, sizeof(dht_shm_segment_t));
+    if(shm->owner) {
+        shm_unlink(shm->name);
+        close(shm->fd);
+    }
+    shm->seg = NULL;
+    shm->owner = 0;
+}
+//============================================================================//
@@ -0,0 +1,152 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_shm.h
+ * @version v1.0.2 -- CHANGELOG
+ *                  | v1.0.0 - Added shared memory publication of readings
+ *                  | v1.0.1 - Segment of a running publisher not replaced
+ *                  | v1.0.2 - Publisher holds a lock on the segment
+ *
+ * @note    The process owning the sensors publishes every reading into a
+ *          POSIX shared memory segment, other processes map it read only:
+ *          - one cache line aligned slot per sensor, each behind a seqlock
+ *            whose sequence is odd while the publisher writes it
+ *          - readers copy a slot and retry if the sequence moved, without
+ *            locks or syscalls, and can never block the publisher
+ *          - the header carries a magic and a layout version checked on open
+ *          - the publisher holds an flock() on the segment while it runs, a
+ *            second one finds it locked, a dead one's lock is released by
+ *            the kernel and its segment replaced
+ *          Only the publisher needs root and /dev/mem, clients link this
+ *          library alone.
+ *
+ *          Times are CLOCK_MONOTONIC, which is shared by all processes, so
+ *          a client can tell the age of a reading or a stopped publisher.
+ *
+ */
+
+#ifndef __DHT_SHM_H__
+#define __DHT_SHM_H__
+
+//===== INCLUDE ==============================================================//
+#include <stddef.h>
+#include <stdint.h>
+//============================================================================//
+
+//===== TYPES, CONSTANTS AND VARIABLES =======================================//
+#define DHT_SHM_NAME            "/smartmirror_dht"
+#define DHT_SHM_SENSORS         4
+#define DHT_SHM_MAGIC           0x4D485344  // "DSHM"
+#define DHT_SHM_VERSION         1
+#define DHT_SHM_RETRIES         1000000
+
+typedef enum DHT_SHM_ERR {
+    DHT_SHM_ERR_BUSY        = -5,
+    DHT_SHM_ERR_EMPTY       = -4,
+    DHT_SHM_ERR_FORMAT      = -3,
+    DHT_SHM_ERR_FILE        = -2,
+    DHT_SHM_ERR_ARG         = -1,
+    DHT_SHM_SUCCESS         = 0
+} dht_shm_err_e;
+
+typedef struct DHT_SHM_READING {
+    float humidity;             // Last good reading
+    float temperature;
+    float filtered_humidity;    // Last good reading through the filters
+    float filtered_temperature;
+    float humidity_min;         // Filtered extremes since the publisher started
+    float humidity_max;
+    float temperature_min;
+    float temperature_max;
+    int32_t status;             // dht_err_e of the latest read
+    uint32_t reads;             // Reads done since the publisher started
+    uint32_t failures;          // Reads that returned an error
+    uint32_t outliers;          // Good readings rejected by the filters
+    uint64_t time_ns;           // CLOCK_MONOTONIC time of the latest read
+    uint64_t good_ns;           // CLOCK_MONOTONIC time of the last good read
+} dht_shm_reading_t;
+
+typedef struct DHT_SHM_SLOT {
+    uint32_t seq;               // Odd while being written, 0 until published
+    uint32_t sensor;
+    dht_shm_reading_t reading;
+} __attribute__((aligned(64))) dht_shm_slot_t;
+
+typedef struct DHT_SHM_SEGMENT {
+    uint32_t magic;             // Written last by the publisher
+    uint16_t version;
+    uint16_t sensors;
+    uint32_t size;              // Bytes of the segment
+    int32_t pid;                // Publisher process
+    uint64_t start_ns;          // CLOCK_MONOTONIC time it was created
+    dht_shm_slot_t slot[DHT_SHM_SENSORS];
+} dht_shm_segment_t;
+
+typedef struct DHT_SHM {
+    char name[64];
+    int owner;                  // Publisher, unlinks the segment on close
+    int fd;                     // Locked segment of the publisher
+    dht_shm_segment_t *seg;
+} dht_shm_t;
+//============================================================================//
+
+//===== FUNCTION DECLARATION =================================================//
+/*!
+ * @brief Creates the segment and maps it for publishing, a stale segment of
+ *        the same name is replaced
+ * @param [shm] dht_shm_t - Publisher to create
+ * @param [name] char - Segment name, DHT_SHM_NAME by default
+ * @return 0 if success, DHT_SHM_ERR_BUSY if the publisher of an existing
+ *         segment still runs, else negative values for other errors
+ */
+int dht_shm_create(dht_shm_t *shm, const char *name);
+
+/*!
+ * @brief Writes the reading of a sensor, readers see all of it or none
+ * @param [shm] dht_shm_t - Publisher
+ * @param [sensor] int - Sensor id (0..DHT_SHM_SENSORS-1)
+ * @param [reading] dht_shm_reading_t - Reading to publish
+ * @return 0 if success else negative values for various possible errors
+ *
+ * @note Only one thread may publish to a slot
+ */
+int dht_shm_publish(dht_shm_t *shm, int sensor, const dht_shm_reading_t *reading);
+
+/*!
+ * @brief Maps an existing segment read only
+ * @param [shm] dht_shm_t - Client to open
+ * @param [name] char - Segment name, DHT_SHM_NAME by default
+ * @return 0 if success else negative values for various possible errors
+ */
+int dht_shm_open(dht_shm_t *shm, const char *name);
+
+/*!
+ * @brief Copies the latest reading of a sensor. Lock free and without
+ *        syscalls, safe from any number of threads and processes.
+ * @param [shm] dht_shm_t - Client or publisher
+ * @param [sensor] int - Sensor id (0..DHT_SHM_SENSORS-1)
+ * @param [reading] dht_shm_reading_t - Output of the reading
+ * @return 0 if success, DHT_SHM_ERR_EMPTY if nothing was published yet,
+ *         DHT_SHM_ERR_BUSY if the slot stayed half written (publisher died
+ *         while writing it)
+ */
+int dht_shm_read(const dht_shm_t *shm, int sensor, dht_shm_reading_t *reading);
+
+/*!
+ * @brief Unmaps the segment, the publisher also removes it
+ * @param [shm] dht_shm_t - Publisher or client
+ * @return None
+ */
+void dht_shm_close(dht_shm_t *shm);
+//============================================================================//
+
+#endif //__DHT_SHM_H__
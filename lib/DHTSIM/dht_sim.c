@@ -0,0 +1,440 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_sim.c
+ * @version v1.1.0 -- CHANGELOG
+ *                  | v1.0.0 - Added DHT11/DHT22 waveform generator
+ *                  | v1.1.0 - Added GPIO character device stand-in
+ *
+ * @note    This is a library written in standard C to simulate DHT sensors
+ *          on the simulated gpio banks of the MMIO library
+ *
+ * @sa      doc/DHT11_Technical_Reference.pdf
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <linux/gpio.h>
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "dht_sim.h"
+#include "dht_common.h"
+#include "dht_line.h"
+#include "mmio.h"
+#include "mmio_sim.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+/*!
+ * @brief Timings of the response waveform in microseconds
+ * @sa    doc/DHT11_Technical_Reference.pdf -- Section 5. Communication Process
+ */
+static const uint32_t SIM_DHT11_START_US    = 18000;
+static const uint32_t SIM_DHT22_START_US    = 1000;
+static const uint32_t SIM_RESPONSE_WAIT_US  = 30;
+static const uint32_t SIM_RESPONSE_US       = 80;
+static const uint32_t SIM_BIT_LOW_US        = 50;
+static const uint32_t SIM_BIT_ZERO_US       = 27;
+static const uint32_t SIM_BIT_ONE_US        = 70;
+static const uint32_t SIM_GLITCH_US         = 1;
+static const uint32_t SIM_IDLE_POLL_US      = 50;
+
+#define SIM_MAX_SEGMENTS    (3 + 40 * 4 + 1)
+
+typedef enum SIM_STATE {
+    SIM_IDLE,
+    SIM_START,
+    SIM_RESPOND
+} sim_state_e;
+
+typedef struct SIM_SEGMENT {
+    uint8_t lvl;
+    uint32_t ns;
+} sim_segment_t;
+
+typedef struct SIM_DEVICE {
+    dht_sim_cfg_t cfg;
+    uint32_t mask;
+    uint32_t rng;
+    sim_state_e state;
+    uint64_t since;
+    uint64_t edge;
+    int index;
+    int count;
+    sim_segment_t seg[SIM_MAX_SEGMENTS];
+    dht_sim_stats_t stats;
+} sim_device_t;
+
+static sim_device_t sim_dev[DHT_SIM_MAX_DEVICES];
+static int sim_count = 0;
+static int sim_running = 0;
+static int sim_line = 0;
+static pthread_t sim_thread;
+
+static int line_request(int base, int num, dht_line_t *line);
+static int line_drive(dht_line_t *line, int lvl);
+static int line_listen(dht_line_t *line);
+static void line_release(dht_line_t *line);
+
+static const dht_line_backend_t SIM_LINE_BACKEND = {
+    .name = "sim",
+    .request = line_request,
+    .drive = line_drive,
+    .listen = line_listen,
+    .release = line_release
+};
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static uint64_t sim_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static uint32_t sim_rand(sim_device_t *dev) {
+    // xorshift32, good enough for fault injection
+    uint32_t x = dev->rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    dev->rng = x;
+    return x;
+}
+
+static int sim_chance(sim_device_t *dev, float rate) {
+    if(rate <= 0.0f) { return 0; }
+    return (sim_rand(dev) >> 8) < (uint32_t) (rate * 16777216.0f);
+}
+
+static void sim_push(sim_device_t *dev, int lvl, uint32_t us) {
+    // Random jitter applied to every pulse, never shorter than a microsecond
+    int32_t width = (int32_t) us;
+    if(dev->cfg.jitter_us > 0) {
+        uint32_t span = 2 * dev->cfg.jitter_us + 1;
+        width += (int32_t) (sim_rand(dev) % span) - (int32_t) dev->cfg.jitter_us;
+    }
+    if(width < 1) { width = 1; }
+
+    dev->seg[dev->count].lvl = lvl;
+    dev->seg[dev->count].ns = (uint32_t) width * 1000;
+    dev->count++;
+}
+
+static void sim_build_frame(sim_device_t *dev) {
+    uint8_t data[5];
+    dht_sim_encode(dev->cfg.type, dev->cfg.humidity, dev->cfg.temperature, data);
+    if(sim_chance(dev, dev->cfg.bad_csum_rate)) {
+        data[4] ^= 1 << (sim_rand(dev) % 8);
+        __atomic_fetch_add(&dev->stats.bad_csums, 1, __ATOMIC_RELAXED);
+    }
+
+    dev->count = 0;
+    sim_push(dev, HIGH, SIM_RESPONSE_WAIT_US);
+    sim_push(dev, LOW, SIM_RESPONSE_US);
+    sim_push(dev, HIGH, SIM_RESPONSE_US);
+
+    for(int i = 0; i < 40; i++) {
+        int bit = (data[i / 8] >> (7 - i % 8)) & 1;
+        uint32_t high = bit ? SIM_BIT_ONE_US : SIM_BIT_ZERO_US;
+
+        sim_push(dev, LOW, SIM_BIT_LOW_US);
+        if(sim_chance(dev, dev->cfg.glitch_rate)) {
+            // Short spike splitting the high pulse in two
+            uint32_t head = high / 2;
+            sim_push(dev, HIGH, head);
+            dev->seg[dev->count].lvl = LOW;
+            dev->seg[dev->count].ns = SIM_GLITCH_US * 1000;
+            dev->count++;
+            sim_push(dev, HIGH, high - head);
+            __atomic_fetch_add(&dev->stats.glitches, 1, __ATOMIC_RELAXED);
+        } else {
+            sim_push(dev, HIGH, high);
+        }
+    }
+
+    sim_push(dev, LOW, SIM_BIT_LOW_US);
+}
+
+static int sim_step(sim_device_t *dev, uint32_t lines, uint64_t now) {
+    int lvl = (lines & dev->mask) ? HIGH : LOW;
+
+    switch(dev->state) {
+    case SIM_IDLE:
+        if(lvl == LOW) {
+            dev->state = SIM_START;
+            dev->since = now;
+        }
+        return dev->state != SIM_IDLE;
+
+    case SIM_START:
+        if(lvl == HIGH) {
+            uint32_t min = dev->cfg.type == DHT22 ? SIM_DHT22_START_US : SIM_DHT11_START_US;
+            dev->state = SIM_IDLE;
+            if(now - dev->since < (uint64_t) min * 1000) { return 0; }
+
+            __atomic_fetch_add(&dev->stats.starts, 1, __ATOMIC_RELAXED);
+            if(sim_chance(dev, dev->cfg.no_response_rate)) {
+                __atomic_fetch_add(&dev->stats.ignored, 1, __ATOMIC_RELAXED);
+                return 0;
+            }
+
+            sim_build_frame(dev);
+            dev->state = SIM_RESPOND;
+            dev->index = 0;
+            dev->edge = now + dev->seg[0].ns;
+            mmio_sim_drive(dev->cfg.base, dev->mask, dev->seg[0].lvl);
+        }
+        return 1;
+
+    case SIM_RESPOND:
+        while(now >= dev->edge) {
+            if(++dev->index >= dev->count) {
+                mmio_sim_drive(dev->cfg.base, dev->mask, HIGH);
+                __atomic_fetch_add(&dev->stats.frames, 1, __ATOMIC_RELAXED);
+                dev->state = SIM_IDLE;
+                return 0;
+            }
+            mmio_sim_drive(dev->cfg.base, dev->mask, dev->seg[dev->index].lvl);
+            dev->edge += dev->seg[dev->index].ns;
+        }
+        return 1;
+    }
+
+    return 0;
+}
+
+static void *sim_run(void *arg) {
+    uint32_t used = 0;
+    for(int i = 0; i < sim_count; i++) {
+        used |= 1 << sim_dev[i].cfg.base;
+    }
+
+    while(__atomic_load_n(&sim_running, __ATOMIC_ACQUIRE)) {
+        uint32_t lines[4] = { 0 };
+        for(int b = 0; b < 4; b++) {
+            if(used & (1 << b)) { lines[b] = mmio_sim_sync(b); }
+        }
+
+        uint64_t now = sim_now_ns();
+        int busy = 0;
+        for(int i = 0; i < sim_count; i++) {
+            busy |= sim_step(&sim_dev[i], lines[sim_dev[i].cfg.base], now);
+        }
+
+        // Level changes made by the devices become visible right away
+        for(int b = 0; b < 4; b++) {
+            if(used & (1 << b)) { mmio_sim_sync(b); }
+        }
+
+        // Sleep between polls unless a start signal or frame is in progress
+        if(!busy) {
+            struct timespec idle = { 0, SIM_IDLE_POLL_US * 1000L };
+            nanosleep(&idle, NULL);
+        }
+    }
+
+    return NULL;
+}
+
+static int sim_setup(const dht_sim_cfg_t *cfg, int count) {
+    if(cfg == NULL || count < 1 || count > DHT_SIM_MAX_DEVICES) { return DHT_ERR_ARGUMENT; }
+    if(sim_running || sim_line) { return DHT_ERR_ARGUMENT; }
+
+    for(int i = 0; i < count; i++) {
+        if(cfg[i].base < 0 || cfg[i].base > 3) { return DHT_ERR_ARGUMENT; }
+        if(cfg[i].num < 0 || cfg[i].num > 31) { return DHT_ERR_ARGUMENT; }
+    }
+
+    memset(sim_dev, 0, sizeof(sim_dev));
+    for(int i = 0; i < count; i++) {
+        sim_dev[i].cfg = cfg[i];
+        sim_dev[i].mask = 1u << cfg[i].num;
+        sim_dev[i].rng = cfg[i].seed ? cfg[i].seed : 0x2545F491u + (uint32_t) i;
+        sim_dev[i].state = SIM_IDLE;
+    }
+    sim_count = count;
+    return DHT_SUCCESS;
+}
+
+static sim_device_t *line_device(int base, int num) {
+    for(int i = 0; i < sim_count; i++) {
+        if(sim_dev[i].cfg.base == base && sim_dev[i].cfg.num == num) { return &sim_dev[i]; }
+    }
+    return NULL;
+}
+
+static int line_request(int base, int num, dht_line_t *line) {
+    if(line_device(base, num) == NULL) { return DHT_ERR_GPIO; }
+
+    // Events are written to the pipe the reader drains
+    int fds[2];
+    if(pipe2(fds, O_CLOEXEC) != 0) { return DHT_ERR_GPIO; }
+    line->fd = fds[0];
+    line->priv = fds[1];
+    return DHT_SUCCESS;
+}
+
+static int line_drive(dht_line_t *line, int lvl) {
+    sim_device_t *dev = line_device(line->base, line->num);
+    dev->state = lvl == LOW ? SIM_START : SIM_IDLE;
+    dev->since = sim_now_ns();
+    return DHT_SUCCESS;
+}
+
+static void line_event(dht_line_t *line, uint32_t id, uint64_t ns, uint32_t seqno) {
+    struct gpio_v2_line_event event;
+    memset(&event, 0, sizeof(event));
+    event.timestamp_ns = ns;
+    event.id = id;
+    event.offset = (uint32_t) line->num;
+    event.seqno = seqno;
+    event.line_seqno = seqno;
+
+    // Smaller than PIPE_BUF, every record is written whole
+    if(write(line->priv, &event, sizeof(event)) != (ssize_t) sizeof(event)) { return; }
+}
+
+static int line_listen(dht_line_t *line) {
+    sim_device_t *dev = line_device(line->base, line->num);
+    uint64_t now = sim_now_ns();
+    if(dev->state != SIM_START) { return DHT_SUCCESS; }
+
+    uint32_t min = dev->cfg.type == DHT22 ? SIM_DHT22_START_US : SIM_DHT11_START_US;
+    dev->state = SIM_IDLE;
+    if(now - dev->since < (uint64_t) min * 1000) { return DHT_SUCCESS; }
+
+    __atomic_fetch_add(&dev->stats.starts, 1, __ATOMIC_RELAXED);
+    if(sim_chance(dev, dev->cfg.no_response_rate)) {
+        __atomic_fetch_add(&dev->stats.ignored, 1, __ATOMIC_RELAXED);
+        return DHT_SUCCESS;
+    }
+
+    // The whole frame is queued at once, timestamped as if it was on the wire
+    sim_build_frame(dev);
+    int lvl = HIGH;
+    uint32_t seqno = 0;
+    for(int i = 0; i < dev->count; i++) {
+        if(dev->seg[i].lvl != lvl) {
+            lvl = dev->seg[i].lvl;
+            line_event(line, lvl == LOW ? GPIO_V2_LINE_EVENT_FALLING_EDGE : GPIO_V2_LINE_EVENT_RISING_EDGE,
+                now, ++seqno);
+        }
+        now += dev->seg[i].ns;
+    }
+    if(lvl == LOW) {
+        line_event(line, GPIO_V2_LINE_EVENT_RISING_EDGE, now, ++seqno);
+    }
+    __atomic_fetch_add(&dev->stats.frames, 1, __ATOMIC_RELAXED);
+    return DHT_SUCCESS;
+}
+
+static void line_release(dht_line_t *line) {
+    close(line->fd);
+    close(line->priv);
+}
+
+int dht_sim_start(const dht_sim_cfg_t *cfg, int count, int cpu) {
+    int result = sim_setup(cfg, count);
+    if(result != DHT_SUCCESS) { return result; }
+
+    for(int i = 0; i < count; i++) {
+        mmio_sim_drive(cfg[i].base, sim_dev[i].mask, HIGH);
+    }
+
+    mmio_set_backend(&MMIO_BACKEND_SIM);
+
+    sim_running = 1;
+    if(pthread_create(&sim_thread, NULL, sim_run, NULL) != 0) {
+        sim_running = 0;
+        mmio_set_backend(NULL);
+        return DHT_ERR_GPIO;
+    }
+
+    if(cpu >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        pthread_setaffinity_np(sim_thread, sizeof(set), &set);
+    }
+
+    return DHT_SUCCESS;
+}
+
+int dht_sim_start_line(const dht_sim_cfg_t *cfg, int count) {
+    int result = sim_setup(cfg, count);
+    if(result != DHT_SUCCESS) { return result; }
+
+    dht_line_set_backend(&SIM_LINE_BACKEND);
+    sim_line = 1;
+    return DHT_SUCCESS;
+}
+
+void dht_sim_stop(void) {
+    if(sim_line) {
+        dht_line_set_backend(NULL);
+        sim_line = 0;
+    }
+    if(!sim_running) { return; }
+
+    __atomic_store_n(&sim_running, 0, __ATOMIC_RELEASE);
+    pthread_join(sim_thread, NULL);
+
+    for(int i = 0; i < sim_count; i++) {
+        mmio_sim_drive(sim_dev[i].cfg.base, sim_dev[i].mask, HIGH);
+    }
+    mmio_set_backend(NULL);
+}
+
+void dht_sim_stats(int index, dht_sim_stats_t *stats) {
+    if(stats == NULL) { return; }
+    memset(stats, 0, sizeof(*stats));
+    if(index < 0 || index >= sim_count) { return; }
+
+    const dht_sim_stats_t *src = &sim_dev[index].stats;
+    stats->starts = __atomic_load_n(&src->starts, __ATOMIC_RELAXED);
+    stats->frames = __atomic_load_n(&src->frames, __ATOMIC_RELAXED);
+    stats->glitches = __atomic_load_n(&src->glitches, __ATOMIC_RELAXED);
+    stats->bad_csums = __atomic_load_n(&src->bad_csums, __ATOMIC_RELAXED);
+    stats->ignored = __atomic_load_n(&src->ignored, __ATOMIC_RELAXED);
+}
+
+void dht_sim_encode(int type, float humidity, float temperature, uint8_t data[5]) {
+    if(type == DHT22) {
+        uint32_t h = (uint32_t) (humidity * 10.0f + 0.5f);
+        float t = temperature < 0.0f ? -temperature : temperature;
+        uint32_t tv = (uint32_t) (t * 10.0f + 0.5f);
+
+        data[0] = (h >> 8) & 0xFF;
+        data[1] = h & 0xFF;
+        data[2] = (tv >> 8) & 0x7F;
+        data[3] = tv & 0xFF;
+        if(temperature < 0.0f) { data[2] |= 0x80; }
+    } else {
+        uint32_t h = (uint32_t) (humidity * 10.0f + 0.5f);
+        uint32_t t = (uint32_t) (temperature * 10.0f + 0.5f);
+
+        data[0] = h / 10;
+        data[1] = h % 10;
+        data[2] = t / 10;
+        data[3] = t % 10;
+    }
+
+    data[4] = (data[0] + data[1] + data[2] + data[3]) & 0xFF;
+}
+//============================================================================//
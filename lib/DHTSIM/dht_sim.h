@@ -0,0 +1,115 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    dht_sim.h
+ * @version v1.1.0 -- CHANGELOG
+ *                  | v1.0.0 - Added DHT11/DHT22 waveform generator
+ *                  | v1.1.0 - Added GPIO character device stand-in
+ *
+ * @note    Simulated DHT sensors answering the start signal of the host on the
+ *          simulated gpio banks of the MMIO library. A companion thread
+ *          watches the lines and drives the response waveform with optional
+ *          jitter, glitches and corrupted checksums.
+ *
+ *          For DHT_CAPTURE_EVENT the same sensors can answer through a
+ *          stand-in for the GPIO character device instead, which needs no
+ *          thread and no spare CPU.
+ *
+ * @sa      doc/DHT11_Technical_Reference.pdf
+ *
+ */
+
+#ifndef __DHT_SIM_H__
+#define __DHT_SIM_H__
+
+//===== INCLUDE ==============================================================//
+#include <stdint.h>
+//============================================================================//
+
+//===== TYPES, CONSTANTS AND VARIABLES =======================================//
+#define DHT_SIM_MAX_DEVICES     32
+
+typedef struct DHT_SIM_CFG {
+    int type;                   // DHT11 or DHT22
+    int base;                   // Gpio base of the sensor (0..3)
+    int num;                    // Gpio number of the sensor (0..31)
+    float humidity;             // Humidity reported by the sensor
+    float temperature;          // Temperature reported by the sensor
+    uint32_t jitter_us;         // Max random deviation added to each pulse
+    float glitch_rate;          // Probability of a short spike per bit
+    float bad_csum_rate;        // Probability of a corrupted checksum per frame
+    float no_response_rate;     // Probability of ignoring a start signal
+    uint32_t seed;              // Seed of the random generator
+} dht_sim_cfg_t;
+
+typedef struct DHT_SIM_STATS {
+    uint32_t starts;            // Start signals seen
+    uint32_t frames;            // Frames transmitted
+    uint32_t glitches;          // Spikes injected
+    uint32_t bad_csums;         // Frames sent with a corrupted checksum
+    uint32_t ignored;           // Start signals left unanswered
+} dht_sim_stats_t;
+//============================================================================//
+
+//===== FUNCTION DECLARATION =================================================//
+/*!
+ * @brief Selects the simulated MMIO backend and starts the thread driving the
+ *        configured sensors
+ * @param [cfg] dht_sim_cfg_t - Array of sensor configurations
+ * @param [count] int - Number of sensors (1..DHT_SIM_MAX_DEVICES)
+ * @param [cpu] int - CPU the thread is pinned to, negative to leave unpinned
+ * @return 0 if success else negative values for various possible errors
+ *
+ * @note The generator busy-waits while a frame is on the wire, it needs a CPU
+ *       of its own to produce the waveform at the right timing.
+ */
+int dht_sim_start(const dht_sim_cfg_t *cfg, int count, int cpu);
+
+/*!
+ * @brief Selects a stand-in for the GPIO character device used by
+ *        DHT_CAPTURE_EVENT (see dht_line.h). Releasing a line after a long
+ *        enough start signal queues the edge events of a whole frame at once,
+ *        timestamped as if it was on the wire.
+ * @param [cfg] dht_sim_cfg_t - Array of sensor configurations
+ * @param [count] int - Number of sensors (1..DHT_SIM_MAX_DEVICES)
+ * @return 0 if success else negative values for various possible errors
+ */
+int dht_sim_start_line(const dht_sim_cfg_t *cfg, int count);
+
+/*!
+ * @brief Stops the simulation thread and restores the /dev/mem backend, or
+ *        the GPIO character device after dht_sim_start_line
+ * @param None
+ * @return None
+ */
+void dht_sim_stop(void);
+
+/*!
+ * @brief Get the counters of a simulated sensor
+ * @param [index] int - Index of the sensor in the configuration array
+ * @param [stats] dht_sim_stats_t - Output of the counters
+ * @return None
+ */
+void dht_sim_stats(int index, dht_sim_stats_t *stats);
+
+/*!
+ * @brief Encodes humidity and temperature into the 5 byte frame of a sensor
+ * @param [type] int - Type of sensor i.e. DHT11, DHT22 etc.
+ * @param [humidity] float - Humidity value
+ * @param [temperature] float - Temperature value
+ * @param [data] uint8_t - Output frame including checksum
+ * @return None
+ */
+void dht_sim_encode(int type, float humidity, float temperature, uint8_t data[5]);
+//============================================================================//
+
+#endif //__DHT_SIM_H__
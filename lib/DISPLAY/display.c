@@ -0,0 +1,451 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    display.c
+ * @version v1.1.0 -- CHANGELOG
+ *                  | v1.0.0 - Added dirty rectangle framebuffer renderer
+ *                  | v1.1.0 - Added image widgets
+ *
+ * @note    This is a library written in standard C to drive the display of
+ *          the mirror through the Linux framebuffer
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <fcntl.h>
+#include <linux/fb.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "display.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static int display_rect_clip(const display_t *disp, display_rect_t *rect) {
+    int x1 = rect->x + rect->w;
+    int y1 = rect->y + rect->h;
+    if(rect->x < 0) { rect->x = 0; }
+    if(rect->y < 0) { rect->y = 0; }
+    if(x1 > (int) disp->width) { x1 = (int) disp->width; }
+    if(y1 > (int) disp->height) { y1 = (int) disp->height; }
+
+    rect->w = x1 > rect->x ? x1 - rect->x : 0;
+    rect->h = y1 > rect->y ? y1 - rect->y : 0;
+    return rect->w > 0 && rect->h > 0;
+}
+
+static display_rect_t display_rect_union(display_rect_t a, display_rect_t b) {
+    if(a.w == 0) { return b; }
+    if(b.w == 0) { return a; }
+
+    int x1 = a.x + a.w > b.x + b.w ? a.x + a.w : b.x + b.w;
+    int y1 = a.y + a.h > b.y + b.h ? a.y + a.h : b.y + b.h;
+    display_rect_t rect;
+    rect.x = a.x < b.x ? a.x : b.x;
+    rect.y = a.y < b.y ? a.y : b.y;
+    rect.w = x1 - rect.x;
+    rect.h = y1 - rect.y;
+    return rect;
+}
+
+static int display_rect_touch(display_rect_t a, display_rect_t b) {
+    return a.x <= b.x + b.w && b.x <= a.x + a.w && a.y <= b.y + b.h && b.y <= a.y + a.h;
+}
+
+static void display_add_rect(display_t *disp, display_rect_t rect) {
+    // Touching rectangles are copied as one
+    for(int i = 0; i < disp->rects; i++) {
+        if(display_rect_touch(disp->rect[i], rect)) {
+            disp->rect[i] = display_rect_union(disp->rect[i], rect);
+            return;
+        }
+    }
+    if(disp->rects < DISPLAY_DIRTY_MAX) {
+        disp->rect[disp->rects++] = rect;
+        return;
+    }
+
+    // List full, grow the rectangle that grows the least
+    int best = 0;
+    long growth = -1;
+    for(int i = 0; i < disp->rects; i++) {
+        display_rect_t merged = display_rect_union(disp->rect[i], rect);
+        long more = (long) merged.w * merged.h - (long) disp->rect[i].w * disp->rect[i].h;
+        if(growth < 0 || more < growth) {
+            growth = more;
+            best = i;
+        }
+    }
+    disp->rect[best] = display_rect_union(disp->rect[best], rect);
+}
+
+static void display_mark(display_widget_t *widget, display_rect_t rect) {
+    widget->dirty = display_rect_union(widget->dirty, rect);
+}
+
+static uint8_t *display_pixel(const display_t *disp, int x, int y) {
+    return disp->back + ((size_t) y * disp->width + x) * disp->bytes;
+}
+
+static void display_fill(display_t *disp, display_rect_t rect, uint32_t pixel) {
+    for(int y = rect.y; y < rect.y + rect.h; y++) {
+        uint8_t *row = display_pixel(disp, rect.x, y);
+        if(disp->bytes == 2) {
+            uint16_t *px = (uint16_t *) row;
+            for(int x = 0; x < rect.w; x++) { px[x] = (uint16_t) pixel; }
+        } else {
+            uint32_t *px = (uint32_t *) row;
+            for(int x = 0; x < rect.w; x++) { px[x] = pixel; }
+        }
+    }
+}
+
+static void display_draw_text(display_t *disp, display_widget_t *widget) {
+    const display_font_t *font = widget->font;
+    const size_t cell = (size_t) font->width * font->height * disp->bytes;
+    const size_t line = (size_t) font->width * disp->bytes;
+    const display_rect_t dirty = widget->dirty;
+
+    // Only the cells crossing the dirty rectangle
+    int first = (dirty.x - widget->area.x) / (int) font->width;
+    int last = (dirty.x + dirty.w - 1 - widget->area.x) / (int) font->width;
+    int len = (int) strlen(widget->text);
+    for(int i = first; i <= last && i < widget->chars; i++) {
+        char c = i < len ? widget->text[i] : ' ';
+        const uint8_t *glyph = font->atlas + font->index[(uint8_t) c] * cell;
+        int x = widget->area.x + i * (int) font->width;
+        for(uint32_t y = 0; y < font->height; y++) {
+            memcpy(display_pixel(disp, x, widget->area.y + (int) y), glyph + y * line, line);
+        }
+    }
+}
+
+static void display_draw_spark(display_t *disp, display_widget_t *widget) {
+    const display_rect_t area = widget->area;
+    const display_rect_t dirty = widget->dirty;
+
+    for(int x = dirty.x; x < dirty.x + dirty.w; x++) {
+        int c = x - area.x;
+        display_rect_t column = { x, area.y, 1, area.h };
+        display_fill(disp, column, widget->bg);
+
+        // Vertical run joining the previous point keeps the line unbroken
+        int y = widget->ys[c];
+        if(y < 0) { continue; }
+        int from = y;
+        int to = y;
+        if(c > 0 && widget->ys[c - 1] >= 0) {
+            int prev = widget->ys[c - 1];
+            from = prev < y ? prev : y;
+            to = prev > y ? prev : y;
+        }
+        display_rect_t run = { x, from, 1, to - from + 1 };
+        display_fill(disp, run, widget->fg);
+    }
+}
+
+static void display_draw_image(display_t *disp, display_widget_t *widget) {
+    const display_image_t *image = &widget->image;
+    const display_rect_t dirty = widget->dirty;
+    const size_t len = (size_t) dirty.w * disp->bytes;
+    const uint8_t *src = image->pixels + (size_t) (dirty.y - widget->area.y) * image->stride +
+        (size_t) (dirty.x - widget->area.x) * disp->bytes;
+
+    for(int y = dirty.y; y < dirty.y + dirty.h; y++) {
+        memcpy(display_pixel(disp, dirty.x, y), src, len);
+        src += image->stride;
+    }
+}
+
+static void display_flush(display_t *disp) {
+    for(int i = 0; i < disp->rects; i++) {
+        const display_rect_t rect = disp->rect[i];
+        const size_t len = (size_t) rect.w * disp->bytes;
+        for(int y = rect.y; y < rect.y + rect.h; y++) {
+            memcpy(disp->front + disp->origin + (size_t) y * disp->stride + (size_t) rect.x * disp->bytes,
+                display_pixel(disp, rect.x, y), len);
+        }
+        disp->flushed += (uint64_t) rect.w * rect.h;
+    }
+    disp->rects = 0;
+}
+
+static int display_setup(display_t *disp) {
+    disp->back = calloc((size_t) disp->width * disp->height, disp->bytes);
+    if(disp->back == NULL) {
+        display_close(disp);
+        return DISPLAY_ERR_MAP;
+    }
+    return DISPLAY_SUCCESS;
+}
+
+int display_open(display_t *disp, const char *device) {
+    if(disp == NULL || device == NULL) { return DISPLAY_ERR_ARG; }
+    memset(disp, 0, sizeof(*disp));
+    disp->fd = -1;
+
+    int fd = open(device, O_RDWR | O_CLOEXEC);
+    if(fd < 0) { return DISPLAY_ERR_DEVICE; }
+
+    struct fb_var_screeninfo var;
+    struct fb_fix_screeninfo fix;
+    if(ioctl(fd, FBIOGET_VSCREENINFO, &var) < 0 || ioctl(fd, FBIOGET_FSCREENINFO, &fix) < 0) {
+        close(fd);
+        return DISPLAY_ERR_DEVICE;
+    }
+
+    // RGB565 or 8 bit channels in 32 bit pixels
+    if(var.bits_per_pixel == 32 && var.red.length == 8 && var.green.length == 8 && var.blue.length == 8) {
+        disp->shift[0] = (uint8_t) var.red.offset;
+        disp->shift[1] = (uint8_t) var.green.offset;
+        disp->shift[2] = (uint8_t) var.blue.offset;
+    } else if(var.bits_per_pixel != 16) {
+        close(fd);
+        return DISPLAY_ERR_FORMAT;
+    }
+
+    void *mem = mmap(NULL, fix.smem_len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if(mem == MAP_FAILED) {
+        close(fd);
+        return DISPLAY_ERR_MAP;
+    }
+
+    disp->fd = fd;
+    disp->width = var.xres;
+    disp->height = var.yres;
+    disp->bytes = var.bits_per_pixel / 8;
+    disp->stride = fix.line_length;
+    disp->front_size = fix.smem_len;
+    disp->front = (uint8_t *) mem;
+    disp->origin = (size_t) var.yoffset * fix.line_length + (size_t) var.xoffset * disp->bytes;
+    return display_setup(disp);
+}
+
+int display_open_memory(display_t *disp, uint32_t width, uint32_t height, uint32_t bpp) {
+    if(disp == NULL || width == 0 || height == 0 || (bpp != 16 && bpp != 32)) { return DISPLAY_ERR_ARG; }
+    memset(disp, 0, sizeof(*disp));
+    disp->fd = -1;
+
+    disp->width = width;
+    disp->height = height;
+    disp->bytes = bpp / 8;
+    disp->stride = width * disp->bytes;
+    disp->shift[0] = 16;
+    disp->shift[1] = 8;
+    disp->shift[2] = 0;
+    disp->front_size = (size_t) disp->stride * height;
+    disp->front = calloc(1, disp->front_size);
+    if(disp->front == NULL) { return DISPLAY_ERR_MAP; }
+    return display_setup(disp);
+}
+
+void display_close(display_t *disp) {
+    if(disp == NULL) { return; }
+
+    if(disp->fd >= 0) {
+        munmap(disp->front, disp->front_size);
+        close(disp->fd);
+    } else {
+        free(disp->front);
+    }
+    free(disp->back);
+    disp->front = NULL;
+    disp->back = NULL;
+    disp->fd = -1;
+}
+
+uint32_t display_color(const display_t *disp, uint32_t rgb) {
+    uint32_t r = (rgb >> 16) & 0xFF;
+    uint32_t g = (rgb >> 8) & 0xFF;
+    uint32_t b = rgb & 0xFF;
+    if(disp->bytes == 2) {
+        return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+    }
+    return (r << disp->shift[0]) | (g << disp->shift[1]) | (b << disp->shift[2]);
+}
+
+static int display_add(display_t *disp, display_widget_e type, display_rect_t area) {
+    if(disp->widgets >= DISPLAY_WIDGETS_MAX) { return DISPLAY_ERR_FULL; }
+
+    // Widgets are drawn whole, they must fit on the display
+    display_rect_t clipped = area;
+    if(!display_rect_clip(disp, &clipped) || clipped.w != area.w || clipped.h != area.h) {
+        return DISPLAY_ERR_ARG;
+    }
+
+    display_widget_t *widget = &disp->widget[disp->widgets];
+    memset(widget, 0, sizeof(*widget));
+    widget->type = type;
+    widget->area = area;
+    widget->dirty = area;
+    return disp->widgets++;
+}
+
+int display_text(display_t *disp, int x, int y, int chars, const display_font_t *font) {
+    if(disp == NULL || font == NULL || font->atlas == NULL) { return DISPLAY_ERR_ARG; }
+    if(chars < 1 || chars > DISPLAY_TEXT_MAX) { return DISPLAY_ERR_ARG; }
+
+    display_rect_t area = { x, y, chars * (int) font->width, (int) font->height };
+    int id = display_add(disp, DISPLAY_TEXT, area);
+    if(id < 0) { return id; }
+
+    disp->widget[id].font = font;
+    disp->widget[id].chars = chars;
+    return id;
+}
+
+int display_spark(display_t *disp, display_rect_t area, uint32_t fg, uint32_t bg) {
+    if(disp == NULL || area.w < 1 || area.w > DISPLAY_SPARK_MAX || area.h < 1) { return DISPLAY_ERR_ARG; }
+
+    int id = display_add(disp, DISPLAY_SPARK, area);
+    if(id < 0) { return id; }
+
+    display_widget_t *widget = &disp->widget[id];
+    widget->fg = display_color(disp, fg);
+    widget->bg = display_color(disp, bg);
+    for(int c = 0; c < area.w; c++) {
+        widget->ys[c] = -1;
+    }
+    return id;
+}
+
+int display_image(display_t *disp, int x, int y, const display_image_t *image) {
+    if(disp == NULL || image == NULL || image->pixels == NULL) { return DISPLAY_ERR_ARG; }
+    if(image->width == 0 || image->height == 0 || image->stride < image->width * disp->bytes) {
+        return DISPLAY_ERR_ARG;
+    }
+
+    display_rect_t area = { x, y, (int) image->width, (int) image->height };
+    int id = display_add(disp, DISPLAY_IMAGE, area);
+    if(id < 0) { return id; }
+
+    disp->widget[id].image = *image;
+    return id;
+}
+
+void display_set_text(display_t *disp, int id, const char *text) {
+    if(disp == NULL || text == NULL || id < 0 || id >= disp->widgets) { return; }
+    display_widget_t *widget = &disp->widget[id];
+    if(widget->type != DISPLAY_TEXT) { return; }
+
+    // Cells past the end of a text are blank
+    int old = 1;
+    int now = 1;
+    for(int i = 0; i < widget->chars; i++) {
+        char before = old && widget->text[i] != '\0' ? widget->text[i] : ' ';
+        char after = now && text[i] != '\0' ? text[i] : ' ';
+        old = old && widget->text[i] != '\0';
+        now = now && text[i] != '\0';
+        if(before == after) { continue; }
+
+        display_rect_t cell = {
+            widget->area.x + i * (int) widget->font->width,
+            widget->area.y,
+            (int) widget->font->width,
+            (int) widget->font->height
+        };
+        display_mark(widget, cell);
+    }
+
+    size_t len = strnlen(text, (size_t) widget->chars);
+    memcpy(widget->text, text, len);
+    widget->text[len] = '\0';
+}
+
+void display_set_spark(display_t *disp, int id, const float *values, int count, float lo, float hi) {
+    if(disp == NULL || id < 0 || id >= disp->widgets) { return; }
+    display_widget_t *widget = &disp->widget[id];
+    if(widget->type != DISPLAY_SPARK) { return; }
+
+    const display_rect_t area = widget->area;
+    const float span = hi > lo ? hi - lo : 1.0f;
+    int first = -1;
+    int last = -1;
+    for(int c = 0; c < area.w; c++) {
+        int y = -1;
+        if(values != NULL && count > 0) {
+            float value = values[(long) c * count / area.w];
+            if(!isnan(value)) {
+                float t = (value - lo) / span;
+                t = t < 0.0f ? 0.0f : t > 1.0f ? 1.0f : t;
+                y = area.y + area.h - 1 - (int) lrintf(t * (area.h - 1));
+            }
+        }
+        if(widget->ys[c] == y) { continue; }
+
+        // The next column joins this point, it moves as well
+        widget->ys[c] = (int16_t) y;
+        if(first < 0) { first = c; }
+        last = c + 1 < area.w ? c + 1 : c;
+    }
+
+    if(first >= 0) {
+        display_rect_t columns = { area.x + first, area.y, last - first + 1, area.h };
+        display_mark(widget, columns);
+    }
+}
+
+void display_set_image(display_t *disp, int id, const display_image_t *image) {
+    if(disp == NULL || image == NULL || image->pixels == NULL || id < 0 || id >= disp->widgets) { return; }
+    display_widget_t *widget = &disp->widget[id];
+    if(widget->type != DISPLAY_IMAGE) { return; }
+    if(image->width != widget->image.width || image->height != widget->image.height ||
+       image->stride < image->width * disp->bytes) {
+        return;
+    }
+
+    if(image->pixels != widget->image.pixels) { display_mark(widget, widget->area); }
+    widget->image = *image;
+}
+
+void display_clear(display_t *disp, uint32_t rgb) {
+    if(disp == NULL) { return; }
+
+    display_rect_t all = { 0, 0, (int) disp->width, (int) disp->height };
+    display_fill(disp, all, display_color(disp, rgb));
+    display_add_rect(disp, all);
+    for(int i = 0; i < disp->widgets; i++) {
+        disp->widget[i].dirty = disp->widget[i].area;
+    }
+}
+
+int display_update(display_t *disp) {
+    if(disp == NULL) { return 0; }
+
+    for(int i = 0; i < disp->widgets; i++) {
+        display_widget_t *widget = &disp->widget[i];
+        if(widget->dirty.w == 0) { continue; }
+
+        if(widget->type == DISPLAY_TEXT) {
+            display_draw_text(disp, widget);
+        } else if(widget->type == DISPLAY_SPARK) {
+            display_draw_spark(disp, widget);
+        } else {
+            display_draw_image(disp, widget);
+        }
+        display_add_rect(disp, widget->dirty);
+        widget->dirty.w = 0;
+        widget->dirty.h = 0;
+    }
+
+    int rects = disp->rects;
+    display_flush(disp);
+    return rects;
+}
+//============================================================================//
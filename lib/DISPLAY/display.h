@@ -0,0 +1,263 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    display.h
+ * @version v1.1.0 -- CHANGELOG
+ *                  | v1.0.0 - Added dirty rectangle framebuffer renderer
+ *                  | v1.1.0 - Added image widgets and fonts over mapped atlases
+ *
+ * @note    Widgets of the mirror (text such as the clock or a reading, and
+ *          sparklines) are drawn into a back buffer and only the rectangles
+ *          that changed are copied to the framebuffer:
+ *          - a text widget redraws the character cells whose glyph changed,
+ *            so a ticking clock touches one or two cells per second
+ *          - a sparkline redraws the columns whose point moved
+ *          - changed rectangles are merged before the copy
+ *          Glyphs are rasterized once per font, at its scale and colors and
+ *          in the pixel format of the display, so drawing one is a copy of
+ *          its rows. Nothing is allocated after the setup.
+ *
+ *          Supported framebuffers are 16 bpp RGB565 and 32 bpp XRGB8888,
+ *          a memory display of the same formats stands in for /dev/fb0.
+ *
+ *          Images and font atlases can also live in an asset pack mapped by
+ *          display_pack.h, already in the pixel format of the display. Their
+ *          rows are copied straight from the mapping.
+ *
+ */
+
+#ifndef __DISPLAY_H__
+#define __DISPLAY_H__
+
+//===== INCLUDE ==============================================================//
+#include <stddef.h>
+#include <stdint.h>
+//============================================================================//
+
+//===== TYPES, CONSTANTS AND VARIABLES =======================================//
+#define DISPLAY_WIDGETS_MAX     16
+#define DISPLAY_TEXT_MAX        24
+#define DISPLAY_SPARK_MAX       1920
+#define DISPLAY_DIRTY_MAX       32
+
+typedef enum DISPLAY_ERR {
+    DISPLAY_ERR_MISSING     = -7,
+    DISPLAY_ERR_FILE        = -6,
+    DISPLAY_ERR_FULL        = -5,
+    DISPLAY_ERR_FORMAT      = -4,
+    DISPLAY_ERR_MAP         = -3,
+    DISPLAY_ERR_DEVICE      = -2,
+    DISPLAY_ERR_ARG         = -1,
+    DISPLAY_SUCCESS         = 0
+} display_err_e;
+
+typedef enum DISPLAY_WIDGET_TYPE {
+    DISPLAY_TEXT,
+    DISPLAY_SPARK,
+    DISPLAY_IMAGE
+} display_widget_e;
+
+typedef struct DISPLAY_RECT {
+    int x;
+    int y;
+    int w;                      // 0 for an empty rectangle
+    int h;
+} display_rect_t;
+
+typedef struct DISPLAY_FONT {
+    uint32_t width;             // Cell width in pixels, spacing included
+    uint32_t height;            // Cell height in pixels, spacing included
+    uint32_t bg;                // Background in the display pixel format
+    uint8_t index[256];         // Atlas slot of each character
+    int glyphs;
+    const uint8_t *atlas;       // Cells one after another, display format
+    void *memory;               // Rasterized atlas, NULL if mapped
+} display_font_t;
+
+typedef struct DISPLAY_IMAGE {
+    uint32_t width;
+    uint32_t height;
+    uint32_t stride;            // Bytes per row
+    const uint8_t *pixels;      // Display format, must outlive its widgets
+} display_image_t;
+
+typedef struct DISPLAY_WIDGET {
+    display_widget_e type;
+    display_rect_t area;
+    display_rect_t dirty;       // Part of the area to redraw
+    uint32_t fg;                // Sparkline colors, display format
+    uint32_t bg;
+    const display_font_t *font;
+    display_image_t image;
+    int chars;                  // Text cells of the area
+    char text[DISPLAY_TEXT_MAX + 1];
+    int16_t ys[DISPLAY_SPARK_MAX];   // Sparkline row of each column, -1 gap
+} display_widget_t;
+
+typedef struct DISPLAY {
+    int fd;                     // Framebuffer device, -1 for memory
+    uint32_t width;
+    uint32_t height;
+    uint32_t bytes;             // Bytes per pixel, 2 or 4
+    uint32_t stride;            // Bytes per framebuffer line
+    uint8_t shift[3];           // Red, green, blue offsets of 32 bpp pixels
+    uint8_t *front;             // Framebuffer mapping or memory
+    size_t front_size;
+    size_t origin;              // Offset of the visible area in front
+    uint8_t *back;              // Drawn into, copied out by rectangle
+    int widgets;
+    display_widget_t widget[DISPLAY_WIDGETS_MAX];
+    int rects;
+    display_rect_t rect[DISPLAY_DIRTY_MAX];
+    uint64_t flushed;           // Pixels copied to the front since open
+} display_t;
+//============================================================================//
+
+//===== FUNCTION DECLARATION =================================================//
+/*!
+ * @brief Opens and maps a framebuffer device
+ * @param [disp] display_t - Display to open
+ * @param [device] char - Framebuffer device, e.g. /dev/fb0
+ * @return 0 if success else negative values for various possible errors
+ */
+int display_open(display_t *disp, const char *device);
+
+/*!
+ * @brief Opens a display backed by memory instead of a framebuffer
+ * @param [disp] display_t - Display to open
+ * @param [width] uint32_t - Width in pixels
+ * @param [height] uint32_t - Height in pixels
+ * @param [bpp] uint32_t - Bits per pixel, 16 (RGB565) or 32 (XRGB8888)
+ * @return 0 if success else negative values for various possible errors
+ */
+int display_open_memory(display_t *disp, uint32_t width, uint32_t height, uint32_t bpp);
+
+/*!
+ * @brief Unmaps the framebuffer and releases the buffers of a display
+ * @param [disp] display_t - Display to close
+ * @return None
+ */
+void display_close(display_t *disp);
+
+/*!
+ * @brief Converts a color to the pixel format of a display
+ * @param [disp] display_t - Display
+ * @param [rgb] uint32_t - Color as 0xRRGGBB
+ * @return [uint32_t] Pixel value
+ */
+uint32_t display_color(const display_t *disp, uint32_t rgb);
+
+/*!
+ * @brief Rasterizes the glyph atlas of a font. The built-in 5x7 glyphs cover
+ *        digits, ':', '.', '-', '%', '/', 'C', 'E', 'F', 'H', 'R', space and
+ *        the degree sign as byte 0xB0, anything else shows as '?'.
+ * @param [font] display_font_t - Font to build
+ * @param [disp] display_t - Display whose pixel format is used
+ * @param [scale] uint32_t - Pixels per glyph dot (1 for 6x8 cells)
+ * @param [fg] uint32_t - Glyph color as 0xRRGGBB
+ * @param [bg] uint32_t - Background color as 0xRRGGBB
+ * @return 0 if success else negative values for various possible errors
+ */
+int display_font_init(display_font_t *font, const display_t *disp, uint32_t scale, uint32_t fg, uint32_t bg);
+
+/*!
+ * @brief Releases the atlas of a font, a mapped atlas stays with its pack
+ * @param [font] display_font_t - Font to release
+ * @return None
+ */
+void display_font_free(display_font_t *font);
+
+/*!
+ * @brief Adds a text widget
+ * @param [disp] display_t - Display
+ * @param [x] int - Left edge in pixels
+ * @param [y] int - Top edge in pixels
+ * @param [chars] int - Character cells (1..DISPLAY_TEXT_MAX)
+ * @param [font] display_font_t - Font, must outlive the display
+ * @return Widget id if success else negative values for various errors
+ */
+int display_text(display_t *disp, int x, int y, int chars, const display_font_t *font);
+
+/*!
+ * @brief Adds a sparkline widget
+ * @param [disp] display_t - Display
+ * @param [area] display_rect_t - Area, at most DISPLAY_SPARK_MAX wide
+ * @param [fg] uint32_t - Line color as 0xRRGGBB
+ * @param [bg] uint32_t - Background color as 0xRRGGBB
+ * @return Widget id if success else negative values for various errors
+ */
+int display_spark(display_t *disp, display_rect_t area, uint32_t fg, uint32_t bg);
+
+/*!
+ * @brief Adds an image widget, drawn by copying rows of its pixels
+ * @param [disp] display_t - Display
+ * @param [x] int - Left edge in pixels
+ * @param [y] int - Top edge in pixels
+ * @param [image] display_image_t - Image in the display format, the pixels
+ *        must outlive the display
+ * @return Widget id if success else negative values for various errors
+ *
+ * @note Widgets are drawn in the order they were added, add a background
+ *       before the widgets on top of it
+ */
+int display_image(display_t *disp, int x, int y, const display_image_t *image);
+
+/*!
+ * @brief Sets the text of a text widget, marking the cells that changed
+ * @param [disp] display_t - Display
+ * @param [id] int - Text widget
+ * @param [text] char - Text, cut to the cells of the widget
+ * @return None
+ */
+void display_set_text(display_t *disp, int id, const char *text);
+
+/*!
+ * @brief Sets the points of a sparkline widget, marking the columns whose
+ *        point moved. Points are spread over the width, NaN leaves a gap.
+ * @param [disp] display_t - Display
+ * @param [id] int - Sparkline widget
+ * @param [values] float - Points, oldest first
+ * @param [count] int - Number of points
+ * @param [lo] float - Value at the bottom of the area
+ * @param [hi] float - Value at the top of the area
+ * @return None
+ */
+void display_set_spark(display_t *disp, int id, const float *values, int count, float lo, float hi);
+
+/*!
+ * @brief Shows another image of the same size in an image widget, e.g. a
+ *        different icon
+ * @param [disp] display_t - Display
+ * @param [id] int - Image widget
+ * @param [image] display_image_t - Image, ignored unless of the widget size
+ * @return None
+ */
+void display_set_image(display_t *disp, int id, const display_image_t *image);
+
+/*!
+ * @brief Fills the whole display and marks every widget for a redraw
+ * @param [disp] display_t - Display
+ * @param [rgb] uint32_t - Color as 0xRRGGBB
+ * @return None
+ */
+void display_clear(display_t *disp, uint32_t rgb);
+
+/*!
+ * @brief Redraws the dirty parts of the widgets and copies the changed
+ *        rectangles to the framebuffer
+ * @param [disp] display_t - Display
+ * @return Number of rectangles copied
+ */
+int display_update(display_t *disp);
+//============================================================================//
+
+#endif //__DISPLAY_H__
@@ -0,0 +1,121 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    display_font.c
+ * @version v1.1.0 -- CHANGELOG
+ *                  | v1.0.0 - Added built-in glyphs and atlas rasterization
+ *                  | v1.1.0 - Kept the rasterized atlas apart from mapped ones
+ *
+ * @note    This is a library written in standard C to drive the display of
+ *          the mirror through the Linux framebuffer
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <stdlib.h>
+#include <string.h>
+
+#include "display.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+// Glyphs are 5x7 dots in a 6x8 cell, one byte per row with bit 4 leftmost
+#define FONT_COLS       6
+#define FONT_ROWS       8
+#define FONT_DOTS_ROWS  7
+
+typedef struct FONT_GLYPH {
+    uint8_t code;
+    uint8_t rows[FONT_DOTS_ROWS];
+} font_glyph_t;
+
+// The first glyph stands for characters without one
+static const font_glyph_t FONT_GLYPHS[] = {
+    { '?',  { 0x0E, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04 } },
+    { ' ',  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+    { '0',  { 0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E } },
+    { '1',  { 0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E } },
+    { '2',  { 0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F } },
+    { '3',  { 0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E } },
+    { '4',  { 0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02 } },
+    { '5',  { 0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E } },
+    { '6',  { 0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E } },
+    { '7',  { 0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08 } },
+    { '8',  { 0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E } },
+    { '9',  { 0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C } },
+    { ':',  { 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00 } },
+    { '.',  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C } },
+    { '-',  { 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00 } },
+    { '%',  { 0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03 } },
+    { '/',  { 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00 } },
+    { 'C',  { 0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E } },
+    { 'E',  { 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F } },
+    { 'F',  { 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10 } },
+    { 'H',  { 0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11 } },
+    { 'R',  { 0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11 } },
+    { 0xB0, { 0x0C, 0x12, 0x12, 0x0C, 0x00, 0x00, 0x00 } },
+};
+
+static const int FONT_GLYPH_COUNT = sizeof(FONT_GLYPHS) / sizeof(FONT_GLYPHS[0]);
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static void font_put(uint8_t *p, uint32_t bytes, uint32_t pixel) {
+    if(bytes == 2) {
+        *(uint16_t *) p = (uint16_t) pixel;
+    } else {
+        *(uint32_t *) p = pixel;
+    }
+}
+
+int display_font_init(display_font_t *font, const display_t *disp, uint32_t scale, uint32_t fg, uint32_t bg) {
+    if(font == NULL || disp == NULL || scale == 0 || scale > 64) { return DISPLAY_ERR_ARG; }
+    memset(font, 0, sizeof(*font));
+
+    const uint32_t fg_px = display_color(disp, fg);
+    const uint32_t bg_px = display_color(disp, bg);
+    font->width = FONT_COLS * scale;
+    font->height = FONT_ROWS * scale;
+    font->bg = bg_px;
+    font->glyphs = FONT_GLYPH_COUNT;
+
+    const size_t cell = (size_t) font->width * font->height * disp->bytes;
+    uint8_t *atlas = malloc(cell * FONT_GLYPH_COUNT);
+    if(atlas == NULL) { return DISPLAY_ERR_MAP; }
+    font->atlas = atlas;
+    font->memory = atlas;
+
+    // Every cell is drawn once here, text then copies whole rows
+    for(int g = 0; g < FONT_GLYPH_COUNT; g++) {
+        font->index[FONT_GLYPHS[g].code] = (uint8_t) g;
+
+        uint8_t *out = atlas + g * cell;
+        for(uint32_t y = 0; y < font->height; y++) {
+            uint32_t row = y / scale;
+            uint8_t dots = row < FONT_DOTS_ROWS ? FONT_GLYPHS[g].rows[row] : 0;
+            for(uint32_t x = 0; x < font->width; x++) {
+                uint32_t col = x / scale;
+                int on = col < FONT_COLS - 1 && (dots >> (FONT_COLS - 2 - col)) & 1;
+                font_put(out + ((size_t) y * font->width + x) * disp->bytes, disp->bytes, on ? fg_px : bg_px);
+            }
+        }
+    }
+    return DISPLAY_SUCCESS;
+}
+
+void display_font_free(display_font_t *font) {
+    if(font == NULL) { return; }
+    free(font->memory);
+    font->memory = NULL;
+    font->atlas = NULL;
+}
+//============================================================================//
@@ -0,0 +1,189 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    display_pack.c
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added memory mapped asset packs
+ *
+ * @note    This is a library written in standard C to drive the display of
+ *          the mirror through the Linux framebuffer
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "display_pack.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static uint32_t display_pack_hash(uint32_t hash, const void *data, size_t size) {
+    const uint8_t *bytes = (const uint8_t *) data;
+    for(size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+uint32_t display_pack_check(const display_pack_header_t *header, const display_pack_entry_t *toc) {
+    uint32_t hash = display_pack_hash(2166136261u, header, offsetof(display_pack_header_t, check));
+    return display_pack_hash(hash, toc, (size_t) header->assets * sizeof(display_pack_entry_t));
+}
+
+static int display_pack_entry_ok(const display_pack_header_t *header, const display_pack_entry_t *entry) {
+    if(memchr(entry->name, '\0', sizeof(entry->name)) == NULL) { return 0; }
+    if(entry->offset % DISPLAY_PACK_ALIGN != 0 || entry->offset > header->size ||
+       entry->size > header->size - entry->offset) {
+        return 0;
+    }
+    if(entry->width == 0 || entry->height == 0 || entry->stride < (uint64_t) entry->width * header->bytes) {
+        return 0;
+    }
+
+    // Whatever the entry points at must lie inside the file
+    uint64_t need = (uint64_t) entry->stride * entry->height;
+    if(entry->type == DISPLAY_ASSET_FONT) {
+        if(entry->glyphs == 0 || entry->glyphs > 256 || entry->stride != entry->width * header->bytes) {
+            return 0;
+        }
+        need = DISPLAY_PACK_INDEX + need * entry->glyphs;
+    } else if(entry->type != DISPLAY_ASSET_IMAGE) {
+        return 0;
+    }
+    return need <= entry->size;
+}
+
+static int display_pack_verify(const uint8_t *map, size_t length) {
+    const display_pack_header_t *header = (const display_pack_header_t *) map;
+    if(length < sizeof(*header) || header->magic != DISPLAY_PACK_MAGIC || header->version != DISPLAY_PACK_VERSION ||
+       header->size != length || (header->bytes != 2 && header->bytes != 4)) {
+        return DISPLAY_ERR_FORMAT;
+    }
+    if(header->toc % DISPLAY_PACK_ALIGN != 0 || header->toc > length ||
+       (uint64_t) header->assets * sizeof(display_pack_entry_t) > length - header->toc) {
+        return DISPLAY_ERR_FORMAT;
+    }
+
+    const display_pack_entry_t *toc = (const display_pack_entry_t *) (map + header->toc);
+    if(header->check != display_pack_check(header, toc)) { return DISPLAY_ERR_FORMAT; }
+    for(uint32_t i = 0; i < header->assets; i++) {
+        if(!display_pack_entry_ok(header, &toc[i])) { return DISPLAY_ERR_FORMAT; }
+    }
+    return DISPLAY_SUCCESS;
+}
+
+static int display_pack_matches(const display_pack_t *pack, const display_t *disp) {
+    // 16 bpp is always RGB565, 32 bpp channels may sit anywhere
+    const display_pack_header_t *header = pack->header;
+    if(header->bytes != disp->bytes) { return 0; }
+    return disp->bytes == 2 || memcmp(header->shift, disp->shift, sizeof(disp->shift)) == 0;
+}
+
+int display_pack_open(display_pack_t *pack, const char *path) {
+    if(pack == NULL || path == NULL) { return DISPLAY_ERR_ARG; }
+    memset(pack, 0, sizeof(*pack));
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if(fd < 0) { return DISPLAY_ERR_FILE; }
+
+    struct stat st;
+    if(fstat(fd, &st) < 0) {
+        close(fd);
+        return DISPLAY_ERR_FILE;
+    }
+    if((size_t) st.st_size < sizeof(display_pack_header_t)) {
+        close(fd);
+        return DISPLAY_ERR_FORMAT;
+    }
+
+    void *map = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if(map == MAP_FAILED) { return DISPLAY_ERR_MAP; }
+
+    int result = display_pack_verify(map, (size_t) st.st_size);
+    if(result != DISPLAY_SUCCESS) {
+        munmap(map, (size_t) st.st_size);
+        return result;
+    }
+
+    pack->map = map;
+    pack->length = (size_t) st.st_size;
+    pack->header = map;
+    pack->toc = (const display_pack_entry_t *) (pack->map + pack->header->toc);
+    return DISPLAY_SUCCESS;
+}
+
+const display_pack_entry_t *display_pack_find(const display_pack_t *pack, const char *name, display_asset_e type) {
+    if(pack == NULL || pack->map == NULL || name == NULL) { return NULL; }
+
+    // A handful of assets, looked up once at setup
+    for(uint32_t i = 0; i < pack->header->assets; i++) {
+        const display_pack_entry_t *entry = &pack->toc[i];
+        if(entry->type == (uint32_t) type && strcmp(entry->name, name) == 0) { return entry; }
+    }
+    return NULL;
+}
+
+int display_pack_image(const display_pack_t *pack, const display_t *disp, const char *name, display_image_t *image) {
+    if(pack == NULL || pack->map == NULL || disp == NULL || image == NULL) { return DISPLAY_ERR_ARG; }
+
+    const display_pack_entry_t *entry = display_pack_find(pack, name, DISPLAY_ASSET_IMAGE);
+    if(entry == NULL) { return DISPLAY_ERR_MISSING; }
+    if(!display_pack_matches(pack, disp)) { return DISPLAY_ERR_FORMAT; }
+
+    image->width = entry->width;
+    image->height = entry->height;
+    image->stride = entry->stride;
+    image->pixels = pack->map + entry->offset;
+    return DISPLAY_SUCCESS;
+}
+
+int display_pack_font(const display_pack_t *pack, const display_t *disp, const char *name, display_font_t *font) {
+    if(pack == NULL || pack->map == NULL || disp == NULL || font == NULL) { return DISPLAY_ERR_ARG; }
+
+    const display_pack_entry_t *entry = display_pack_find(pack, name, DISPLAY_ASSET_FONT);
+    if(entry == NULL) { return DISPLAY_ERR_MISSING; }
+    if(!display_pack_matches(pack, disp)) { return DISPLAY_ERR_FORMAT; }
+
+    // Slots past the cells would read outside the atlas
+    const uint8_t *index = pack->map + entry->offset;
+    for(int c = 0; c < DISPLAY_PACK_INDEX; c++) {
+        if(index[c] >= entry->glyphs) { return DISPLAY_ERR_FORMAT; }
+    }
+
+    memset(font, 0, sizeof(*font));
+    font->width = entry->width;
+    font->height = entry->height;
+    font->bg = entry->bg;
+    font->glyphs = (int) entry->glyphs;
+    memcpy(font->index, index, sizeof(font->index));
+    font->atlas = index + DISPLAY_PACK_INDEX;
+    return DISPLAY_SUCCESS;
+}
+
+void display_pack_close(display_pack_t *pack) {
+    if(pack == NULL || pack->map == NULL) { return; }
+
+    munmap((void *) pack->map, pack->length);
+    pack->map = NULL;
+    pack->header = NULL;
+    pack->toc = NULL;
+    pack->length = 0;
+}
+//============================================================================//
@@ -0,0 +1,149 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    display_pack.h
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added memory mapped asset packs
+ *
+ * @note    Images and fonts of the mirror come in one pack file made offline
+ *          by tools/asset_pack, already converted to the pixel format of the
+ *          framebuffer:
+ *          - a header with the pixel format and the table of contents
+ *          - one entry per asset with its name, size and row stride
+ *          - the pixels of every asset start on a DISPLAY_PACK_ALIGN
+ *            boundary, a font is its character index then its glyph cells
+ *            laid out like a rasterized atlas
+ *          The pack is mapped read only and nothing is decoded or copied on
+ *          the heap: images and font atlases point into the mapping and
+ *          widgets copy their rows from there. Pages are shared with the page
+ *          cache and only those drawn are read. Opening checks the header and
+ *          the table, the pixels are trusted.
+ *
+ *          Images and fonts taken from a pack must not outlive it.
+ *
+ * @sa      tools/asset_pack.c
+ *
+ */
+
+#ifndef __DISPLAY_PACK_H__
+#define __DISPLAY_PACK_H__
+
+//===== INCLUDE ==============================================================//
+#include <stddef.h>
+#include <stdint.h>
+
+#include "display.h"
+//============================================================================//
+
+//===== TYPES, CONSTANTS AND VARIABLES =======================================//
+#define DISPLAY_PACK_MAGIC      0x4B50534D  // "MSPK"
+#define DISPLAY_PACK_VERSION    1
+#define DISPLAY_PACK_ALIGN      64          // Start of the pixels of an asset
+#define DISPLAY_PACK_NAME_MAX   24
+#define DISPLAY_PACK_INDEX      256         // Character index before font cells
+
+typedef enum DISPLAY_ASSET_TYPE {
+    DISPLAY_ASSET_IMAGE,
+    DISPLAY_ASSET_FONT
+} display_asset_e;
+
+typedef struct DISPLAY_PACK_HEADER {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t bytes;             // Bytes per pixel, 2 (RGB565) or 4
+    uint8_t shift[4];           // Red, green, blue offsets of 32 bpp pixels
+    uint32_t assets;            // Entries in the table of contents
+    uint32_t toc;               // Offset of the table of contents
+    uint32_t size;              // Bytes of the whole pack
+    uint32_t check;             // FNV-1a of the header before it and the table
+    uint32_t reserved;
+} display_pack_header_t;
+
+typedef struct DISPLAY_PACK_ENTRY {
+    char name[DISPLAY_PACK_NAME_MAX];   // NUL terminated
+    uint32_t type;              // display_asset_e
+    uint32_t width;             // Image width or font cell width, in pixels
+    uint32_t height;
+    uint32_t stride;            // Bytes per row of pixels
+    uint32_t glyphs;            // Cells of a font, 0 for an image
+    uint32_t bg;                // Font background in the pack pixel format
+    uint32_t offset;            // Pixels, or the character index of a font
+    uint32_t size;              // Bytes at offset
+    uint32_t reserved[2];
+} display_pack_entry_t;
+
+typedef struct DISPLAY_PACK {
+    const uint8_t *map;
+    size_t length;
+    const display_pack_header_t *header;
+    const display_pack_entry_t *toc;
+} display_pack_t;
+//============================================================================//
+
+//===== FUNCTION DECLARATION =================================================//
+/*!
+ * @brief Maps a pack read only and checks its header and table of contents
+ * @param [pack] display_pack_t - Pack to open
+ * @param [path] char - Pack file
+ * @return 0 if success else negative values for various possible errors
+ */
+int display_pack_open(display_pack_t *pack, const char *path);
+
+/*!
+ * @brief Finds an asset by name
+ * @param [pack] display_pack_t - Open pack
+ * @param [name] char - Asset name
+ * @param [type] display_asset_e - Image or font
+ * @return [display_pack_entry_t] Entry of the asset, NULL if missing
+ */
+const display_pack_entry_t *display_pack_find(const display_pack_t *pack, const char *name, display_asset_e type);
+
+/*!
+ * @brief Points an image at the pixels of an asset in the mapping
+ * @param [pack] display_pack_t - Open pack
+ * @param [disp] display_t - Display the image is drawn on
+ * @param [name] char - Image asset name
+ * @param [image] display_image_t - Output, valid while the pack is open
+ * @return 0 if success, DISPLAY_ERR_MISSING without such an image,
+ *         DISPLAY_ERR_FORMAT if the pack was made for another pixel format
+ */
+int display_pack_image(const display_pack_t *pack, const display_t *disp, const char *name, display_image_t *image);
+
+/*!
+ * @brief Sets up a font whose atlas is the cells of an asset in the mapping
+ * @param [pack] display_pack_t - Open pack
+ * @param [disp] display_t - Display the font is drawn on
+ * @param [name] char - Font asset name
+ * @param [font] display_font_t - Output, valid while the pack is open
+ * @return 0 if success, DISPLAY_ERR_MISSING without such a font,
+ *         DISPLAY_ERR_FORMAT if the pack was made for another pixel format
+ */
+int display_pack_font(const display_pack_t *pack, const display_t *disp, const char *name, display_font_t *font);
+
+/*!
+ * @brief Computes the check of a header and its table of contents, used
+ *        when writing a pack
+ * @param [header] display_pack_header_t - Header
+ * @param [toc] display_pack_entry_t - Table of header->assets entries
+ * @return [uint32_t] Check to store in the header
+ */
+uint32_t display_pack_check(const display_pack_header_t *header, const display_pack_entry_t *toc);
+
+/*!
+ * @brief Unmaps a pack, images and fonts taken from it are no longer valid
+ * @param [pack] display_pack_t - Pack to close
+ * @return None
+ */
+void display_pack_close(display_pack_t *pack);
+//============================================================================//
+
+#endif //__DISPLAY_PACK_H__
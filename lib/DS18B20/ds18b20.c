@@ -0,0 +1,130 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    ds18b20.c
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added DS18B20 1-Wire thermometer
+ *
+ * @note    This is a library written in standard C to interface DS18B20
+ *          sensor on beagle bone black
+ *
+ * @sa      DS18B20 datasheet -- 1-Wire Signaling
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <stddef.h>
+
+#include "dht_pulse.h"
+#include "ds18b20.h"
+#include "mmio.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+#define DS18B20_SCRATCHPAD      9
+
+static const uint8_t DS18B20_SKIP_ROM           = 0xCC;
+static const uint8_t DS18B20_CONVERT_T          = 0x44;
+static const uint8_t DS18B20_READ_SCRATCHPAD    = 0xBE;
+
+// Write 1 and read slots open with a short low, a 0 is held low for most of
+// the slot, reads sample before 15us
+static const dht_pulse_slot_t DS18B20_SLOT = { .low1_us = 6, .low0_us = 60, .sample_us = 14, .slot_us = 70 };
+
+// Reset pulse and presence answer, the sensor pulls low 15-60us after the
+// release for 60-240us, the line then has to rest for the rest of 480us
+#define DS18B20_RESET \
+    { .op = DHT_PULSE_DRIVE, .level = 0, .us = 480 }, \
+    { .op = DHT_PULSE_RELEASE, .us = 0 }, \
+    { .op = DHT_PULSE_WAIT, .level = 0, .us = 70 }, \
+    { .op = DHT_PULSE_WAIT, .level = 1, .us = 250 }, \
+    { .op = DHT_PULSE_RELEASE, .us = 410 }
+
+static const dht_pulse_step_t DS18B20_CONVERT_STEPS[] = {
+    DS18B20_RESET,
+    { .op = DHT_PULSE_WRITE, .count = 16 }
+};
+
+static const dht_pulse_step_t DS18B20_READ_STEPS[] = {
+    DS18B20_RESET,
+    { .op = DHT_PULSE_WRITE, .count = 16 },
+    { .op = DHT_PULSE_READ, .count = DS18B20_SCRATCHPAD * 8 }
+};
+
+static const dht_pulse_proto_t DS18B20_CONVERT_PROTO = {
+    .steps = DS18B20_CONVERT_STEPS,
+    .count = sizeof(DS18B20_CONVERT_STEPS) / sizeof(DS18B20_CONVERT_STEPS[0]),
+    .slot = DS18B20_SLOT
+};
+
+static const dht_pulse_proto_t DS18B20_READ_PROTO = {
+    .steps = DS18B20_READ_STEPS,
+    .count = sizeof(DS18B20_READ_STEPS) / sizeof(DS18B20_READ_STEPS[0]),
+    .slot = DS18B20_SLOT
+};
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static uint8_t ds18b20_crc8(const uint8_t *data, int len) {
+    // Dallas/Maxim x^8 + x^5 + x^4 + 1, reflected
+    uint8_t crc = 0;
+    for(int i = 0; i < len; i++) {
+        crc ^= data[i];
+        for(int b = 0; b < 8; b++) { crc = crc & 1 ? (uint8_t) ((crc >> 1) ^ 0x8C) : (uint8_t) (crc >> 1); }
+    }
+    return crc;
+}
+
+static int ds18b20_run(int base, int num, const dht_pulse_proto_t *proto, dht_pulse_buf_t *buf) {
+    gpio_t pin;
+    if(mmio_get_gpio(base, num, &pin) < 0) { return DS18B20_ERR_GPIO; }
+
+    set_max_priority();
+    int result = dht_pulse_run(&pin, proto, buf, 0);
+    set_default_priority();
+
+    // Only the presence waits can time out
+    return result == DHT_SUCCESS ? DS18B20_SUCCESS : DS18B20_ERR_PRESENCE;
+}
+
+int ds18b20_convert(int base, int num) {
+    dht_pulse_buf_t buf = { .out = { DS18B20_SKIP_ROM, DS18B20_CONVERT_T } };
+    return ds18b20_run(base, num, &DS18B20_CONVERT_PROTO, &buf);
+}
+
+int ds18b20_fetch(int base, int num, float *temperature) {
+    if(temperature == NULL) { return DS18B20_ERR_ARG; }
+    *temperature = 0.0f;
+
+    dht_pulse_buf_t buf = { .out = { DS18B20_SKIP_ROM, DS18B20_READ_SCRATCHPAD } };
+    int result = ds18b20_run(base, num, &DS18B20_READ_PROTO, &buf);
+    if(result != DS18B20_SUCCESS) { return result; }
+
+    // A released line reads all ones, which the CRC does not catch
+    const uint8_t *pad = buf.in;
+    if(pad[4] == 0xFF || ds18b20_crc8(pad, DS18B20_SCRATCHPAD - 1) != pad[DS18B20_SCRATCHPAD - 1]) {
+        return DS18B20_ERR_CRC;
+    }
+
+    *temperature = (float) (int16_t) (pad[0] | pad[1] << 8) / 16.0f;
+    return DS18B20_SUCCESS;
+}
+
+int ds18b20_read(int base, int num, float *temperature) {
+    if(temperature == NULL) { return DS18B20_ERR_ARG; }
+
+    int result = ds18b20_convert(base, num);
+    if(result != DS18B20_SUCCESS) { return result; }
+    sleep_ms(DS18B20_CONVERT_MS);
+    return ds18b20_fetch(base, num, temperature);
+}
+//============================================================================//
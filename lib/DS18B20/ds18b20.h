@@ -0,0 +1,78 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    ds18b20.h
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added DS18B20 1-Wire thermometer
+ *
+ * @note    Single DS18B20 on its own 1-Wire line with external power and a
+ *          4.7k pull-up, addressed with Skip ROM. Reset, presence and the
+ *          bit slots run on the timed engine of the DHT library
+ *          (dht_pulse.h), only a few hundred microseconds at a time are spent
+ *          at FIFO priority; the conversion in between sleeps.
+ *
+ * @sa      DS18B20 Programmable Resolution 1-Wire Digital Thermometer datasheet
+ *
+ */
+
+#ifndef __DS18B20_H__
+#define __DS18B20_H__
+
+//===== INCLUDE ==============================================================//
+#include <stdint.h>
+//============================================================================//
+
+//===== TYPES, CONSTANTS AND VARIABLES =======================================//
+typedef enum DS18B20_ERR {
+    DS18B20_ERR_CRC         = -4,
+    DS18B20_ERR_PRESENCE    = -3,
+    DS18B20_ERR_GPIO        = -2,
+    DS18B20_ERR_ARG         = -1,
+    DS18B20_SUCCESS         = 0
+} ds18b20_err_e;
+
+// Conversion time at the default 12-bit resolution
+static const uint32_t DS18B20_CONVERT_MS        = 750;
+//============================================================================//
+
+//===== FUNCTION DECLARATION =================================================//
+/*!
+ * @brief Starts a temperature conversion
+ * @param [base] int - Gpio base where the sensor is connected (0..3)
+ * @param [num] int - GPIO pin number where the sensor is connected (0..31)
+ * @return 0 if success else negative values for various possible errors
+ */
+int ds18b20_convert(int base, int num);
+
+/*!
+ * @brief Reads the scratchpad holding the last conversion
+ * @param [base] int - Gpio base where the sensor is connected (0..3)
+ * @param [num] int - GPIO pin number where the sensor is connected (0..31)
+ * @param [temperature] float - Output of temperature value in celsius
+ * @return 0 if success else negative values for various possible errors
+ *
+ * @note Call it DS18B20_CONVERT_MS after ds18b20_convert(), from a timer
+ *       rather than blocking
+ */
+int ds18b20_fetch(int base, int num, float *temperature);
+
+/*!
+ * @brief Converts and reads the temperature, sleeping through the conversion
+ * @param [base] int - Gpio base where the sensor is connected (0..3)
+ * @param [num] int - GPIO pin number where the sensor is connected (0..31)
+ * @param [temperature] float - Output of temperature value in celsius
+ * @return 0 if success else negative values for various possible errors
+ */
+int ds18b20_read(int base, int num, float *temperature);
+//============================================================================//
+
+#endif //__DS18B20_H__
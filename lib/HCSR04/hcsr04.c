@@ -0,0 +1,75 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    hcsr04.c
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added HC-SR04 ultrasonic ranging
+ *
+ * @note    This is a library written in standard C to interface HC-SR04
+ *          sensor on beagle bone black
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <stddef.h>
+
+#include "dht_pulse.h"
+#include "hcsr04.h"
+#include "mmio.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+enum { HCSR04_TRIG, HCSR04_ECHO };
+
+// Trigger from a clean low, then the width of the echo once it rises
+static const dht_pulse_step_t HCSR04_STEPS[] = {
+    { .op = DHT_PULSE_DRIVE, .pin = HCSR04_TRIG, .level = 0, .us = 2 },
+    { .op = DHT_PULSE_DRIVE, .pin = HCSR04_TRIG, .level = 1, .us = 10 },
+    { .op = DHT_PULSE_DRIVE, .pin = HCSR04_TRIG, .level = 0, .us = 0 },
+    { .op = DHT_PULSE_WAIT, .pin = HCSR04_ECHO, .level = 1, .us = HCSR04_ECHO_START_US },
+    { .op = DHT_PULSE_MEASURE, .pin = HCSR04_ECHO, .level = 1, .us = HCSR04_ECHO_MAX_US }
+};
+
+static const dht_pulse_proto_t HCSR04_PROTO = {
+    .steps = HCSR04_STEPS,
+    .count = sizeof(HCSR04_STEPS) / sizeof(HCSR04_STEPS[0])
+};
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+int hcsr04_read(int trig_base, int trig_num, int echo_base, int echo_num, float temperature, float *distance) {
+    if(distance == NULL) { return HCSR04_ERR_ARG; }
+    *distance = 0.0f;
+
+    gpio_t pins[2];
+    if(mmio_get_gpio(trig_base, trig_num, &pins[HCSR04_TRIG]) < 0 ||
+       mmio_get_gpio(echo_base, echo_num, &pins[HCSR04_ECHO]) < 0) {
+        return HCSR04_ERR_GPIO;
+    }
+    mmio_set_input(pins[HCSR04_ECHO]);
+
+    uint32_t width = 0;
+    dht_pulse_buf_t buf = { .widths = &width, .max = 1 };
+
+    set_max_priority();
+    int result = dht_pulse_run(pins, &HCSR04_PROTO, &buf, 0);
+    set_default_priority();
+
+    if(result != DHT_SUCCESS) { return HCSR04_ERR_TIMEOUT; }
+    if(width >= HCSR04_RANGE_US) { return HCSR04_ERR_RANGE; }
+
+    // Sound travels there and back, m/s are 1e-4 cm/us
+    float speed = 331.3f + 0.606f * temperature;
+    *distance = (float) width * speed / 2.0f / 10000.0f;
+    return HCSR04_SUCCESS;
+}
+//============================================================================//
@@ -0,0 +1,70 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    hcsr04.h
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added HC-SR04 ultrasonic ranging
+ *
+ * @note    A 10us trigger pulse makes the sensor send a burst, its echo line
+ *          then stays high for the round trip of the sound, 38ms if nothing
+ *          answered. Both lines run on the timed engine of the DHT library
+ *          (dht_pulse.h). The echo is 5V, it needs a divider in front of the
+ *          3.3V input.
+ *
+ * @sa      HC-SR04 Ultrasonic Ranging Module datasheet
+ *
+ */
+
+#ifndef __HCSR04_H__
+#define __HCSR04_H__
+
+//===== INCLUDE ==============================================================//
+#include <stdint.h>
+//============================================================================//
+
+//===== TYPES, CONSTANTS AND VARIABLES =======================================//
+typedef enum HCSR04_ERR {
+    HCSR04_ERR_RANGE        = -4,
+    HCSR04_ERR_TIMEOUT      = -3,
+    HCSR04_ERR_GPIO         = -2,
+    HCSR04_ERR_ARG          = -1,
+    HCSR04_SUCCESS          = 0
+} hcsr04_err_e;
+
+// Echo timings in microseconds, longer echoes are the no obstacle answer
+static const uint32_t HCSR04_ECHO_START_US      = 10000;
+static const uint32_t HCSR04_ECHO_MAX_US        = 38000;
+static const uint32_t HCSR04_RANGE_US           = 25000;
+
+// Sensor needs this long between two measurements
+static const uint32_t HCSR04_PERIOD_MS          = 60;
+//============================================================================//
+
+//===== FUNCTION DECLARATION =================================================//
+/*!
+ * @brief Measures the distance to the nearest obstacle
+ * @param [trig_base] int - Gpio base of the trigger line (0..3)
+ * @param [trig_num] int - GPIO number of the trigger line (0..31)
+ * @param [echo_base] int - Gpio base of the echo line (0..3)
+ * @param [echo_num] int - GPIO number of the echo line (0..31)
+ * @param [temperature] float - Air temperature in celsius for the speed of
+ *        sound, the last DHT reading will do
+ * @param [distance] float - Output of the distance in centimeters
+ * @return 0 if success, HCSR04_ERR_RANGE if nothing was in range else
+ *         negative values for various possible errors
+ *
+ * @note Busy-waits at FIFO priority for the echo, up to 48ms
+ */
+int hcsr04_read(int trig_base, int trig_num, int echo_base, int echo_num, float temperature, float *distance);
+//============================================================================//
+
+#endif //__HCSR04_H__
@@ -0,0 +1,298 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    history.c
+ * @version v1.1.0 -- CHANGELOG
+ *                  | v1.0.0 - Added memory mapped reading history
+ *                  | v1.1.0 - Made the bucket updates undoable
+ *
+ * @note    File layout, all offsets fixed at creation:
+ *          | header (64 bytes)
+ *          | records[capacity]
+ *          | minute buckets[sensors][2880]     (48 hours)
+ *          | hour buckets[sensors][1488]       (62 days)
+ *          | day buckets[sensors][732]         (2 years)
+ *
+ *          Buckets are aligned to UTC.
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <fcntl.h>
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "history.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+static const uint32_t HISTORY_MAGIC = 0x54534948;       // "HIST"
+static const uint16_t HISTORY_VERSION = 2;
+static const uint64_t HISTORY_HEADER_SIZE = 64;
+
+static const uint32_t HISTORY_WIDTH[HISTORY_LEVELS] = { 60, 3600, 86400 };
+static const uint32_t HISTORY_BUCKETS[HISTORY_LEVELS] = { 2880, 1488, 732 };
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static uint16_t history_check(const history_record_t *rec) {
+    // Fletcher-16 seeded with 1 so an all zero slot never checks out
+    const uint8_t *bytes = (const uint8_t *) rec;
+    uint32_t sum1 = 1;
+    uint32_t sum2 = 0;
+    for(size_t i = 0; i < offsetof(history_record_t, check); i++) {
+        sum1 = (sum1 + bytes[i]) % 255;
+        sum2 = (sum2 + sum1) % 255;
+    }
+    return (uint16_t) (sum2 << 8 | sum1);
+}
+
+static int history_valid(const history_record_t *rec, uint64_t index) {
+    return rec->seq == (uint32_t) index && rec->check == history_check(rec);
+}
+
+static uint64_t history_size(uint32_t capacity) {
+    uint64_t size = HISTORY_HEADER_SIZE + (uint64_t) capacity * sizeof(history_record_t);
+    for(int level = 0; level < HISTORY_LEVELS; level++) {
+        size += (uint64_t) HISTORY_SENSORS * HISTORY_BUCKETS[level] * sizeof(history_bucket_t);
+    }
+    return size;
+}
+
+static void history_roll(history_t *hist, const history_record_t *rec, uint64_t index) {
+    if(rec->status != 0 || rec->sensor >= HISTORY_SENSORS) { return; }
+
+    for(int level = 0; level < HISTORY_LEVELS; level++) {
+        uint32_t width = HISTORY_WIDTH[level];
+        uint32_t count = hist->header->buckets[level];
+        uint32_t start = rec->time - rec->time % width;
+        history_bucket_t *bucket = &hist->buckets[level][rec->sensor * count + (start / width) % count];
+
+        if(bucket->start > start) { continue; }     // Slot already reused
+        if(bucket->start != start) {
+            memset(bucket, 0, sizeof(*bucket));
+            bucket->start = start;
+        }
+        if(bucket->applied >= (uint32_t) index + 1) { continue; }
+
+        // Saved before anything changes, recovery restores them if the
+        // update below is cut short. Min and max may safely see it twice.
+        bucket->undo_count = bucket->count;
+        bucket->undo_t_sum = bucket->t_sum;
+        bucket->undo_h_sum = bucket->h_sum;
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        __atomic_store_n(&bucket->pending, (uint32_t) index + 1, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+
+        if(bucket->count == 0 || rec->temperature < bucket->t_min) { bucket->t_min = rec->temperature; }
+        if(bucket->count == 0 || rec->temperature > bucket->t_max) { bucket->t_max = rec->temperature; }
+        if(bucket->count == 0 || rec->humidity < bucket->h_min) { bucket->h_min = rec->humidity; }
+        if(bucket->count == 0 || rec->humidity > bucket->h_max) { bucket->h_max = rec->humidity; }
+        bucket->t_sum += rec->temperature;
+        bucket->h_sum += rec->humidity;
+        bucket->count++;
+        __atomic_store_n(&bucket->applied, (uint32_t) index + 1, __ATOMIC_RELEASE);
+    }
+}
+
+static void history_layout(history_t *hist) {
+    uint8_t *base = (uint8_t *) hist->header;
+    hist->records = (history_record_t *) (base + HISTORY_HEADER_SIZE);
+
+    uint8_t *next = (uint8_t *) (hist->records + hist->header->capacity);
+    for(int level = 0; level < HISTORY_LEVELS; level++) {
+        hist->buckets[level] = (history_bucket_t *) next;
+        next += (uint64_t) HISTORY_SENSORS * HISTORY_BUCKETS[level] * sizeof(history_bucket_t);
+    }
+}
+
+static void history_recover(history_t *hist) {
+    history_header_t *header = hist->header;
+
+    // A record may be complete while the head was not advanced yet
+    while(history_valid(&hist->records[header->head % header->capacity], header->head)) {
+        header->head++;
+    }
+
+    // Updates cut short go back to before the record, which is applied again
+    for(int level = 0; level < HISTORY_LEVELS; level++) {
+        for(uint32_t i = 0; i < HISTORY_SENSORS * header->buckets[level]; i++) {
+            history_bucket_t *bucket = &hist->buckets[level][i];
+            if(bucket->pending == bucket->applied) { continue; }
+            bucket->count = bucket->undo_count;
+            bucket->t_sum = bucket->undo_t_sum;
+            bucket->h_sum = bucket->undo_h_sum;
+            bucket->pending = bucket->applied;
+        }
+    }
+
+    // Buckets skip the records they already counted, so every record still
+    // in the ring is replayed
+    uint64_t first = header->head > header->capacity ? header->head - header->capacity : 0;
+    for(uint64_t index = first; index < header->head; index++) {
+        const history_record_t *rec = &hist->records[index % header->capacity];
+        if(history_valid(rec, index)) {
+            history_roll(hist, rec, index);
+        }
+    }
+}
+
+int history_open(history_t *hist, const char *path, uint32_t capacity) {
+    if(hist == NULL || path == NULL) { return HISTORY_ERR_ARG; }
+    memset(hist, 0, sizeof(*hist));
+    hist->fd = -1;
+
+    int fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if(fd < 0) { return HISTORY_ERR_FILE; }
+
+    struct stat st;
+    history_header_t header;
+    memset(&header, 0, sizeof(header));
+    if(fstat(fd, &st) < 0) {
+        close(fd);
+        return HISTORY_ERR_FILE;
+    }
+    if(st.st_size >= (off_t) sizeof(header) && pread(fd, &header, sizeof(header), 0) != sizeof(header)) {
+        close(fd);
+        return HISTORY_ERR_FILE;
+    }
+
+    // A new file, or one whose creation was interrupted before the magic
+    int create = header.magic == 0;
+    if(create) {
+        if(capacity == 0) {
+            close(fd);
+            return HISTORY_ERR_ARG;
+        }
+        header.magic = HISTORY_MAGIC;
+        header.version = HISTORY_VERSION;
+        header.sensors = HISTORY_SENSORS;
+        header.capacity = capacity;
+        for(int level = 0; level < HISTORY_LEVELS; level++) {
+            header.buckets[level] = HISTORY_BUCKETS[level];
+        }
+        header.head = 0;
+        if(ftruncate(fd, 0) < 0 || ftruncate(fd, (off_t) history_size(capacity)) < 0) {
+            close(fd);
+            return HISTORY_ERR_FILE;
+        }
+    } else {
+        int known = header.magic == HISTORY_MAGIC && header.version == HISTORY_VERSION &&
+            header.sensors == HISTORY_SENSORS && header.capacity != 0;
+        for(int level = 0; level < HISTORY_LEVELS; level++) {
+            known = known && header.buckets[level] == HISTORY_BUCKETS[level];
+        }
+        if(!known || (uint64_t) st.st_size != history_size(header.capacity)) {
+            close(fd);
+            return HISTORY_ERR_FORMAT;
+        }
+    }
+
+    hist->size = history_size(header.capacity);
+    void *map = mmap(NULL, hist->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if(map == MAP_FAILED) {
+        close(fd);
+        return HISTORY_ERR_FILE;
+    }
+    hist->fd = fd;
+    hist->header = (history_header_t *) map;
+
+    if(create) {
+        // The magic goes last, only a fully described file is ever opened
+        uint32_t magic = header.magic;
+        header.magic = 0;
+        memcpy(hist->header, &header, sizeof(header));
+        msync(map, HISTORY_HEADER_SIZE, MS_SYNC);
+        __atomic_store_n(&hist->header->magic, magic, __ATOMIC_RELEASE);
+        msync(map, HISTORY_HEADER_SIZE, MS_SYNC);
+    }
+
+    history_layout(hist);
+    history_recover(hist);
+    return HISTORY_SUCCESS;
+}
+
+void history_close(history_t *hist) {
+    if(hist == NULL || hist->header == NULL) { return; }
+
+    munmap(hist->header, hist->size);
+    close(hist->fd);
+    memset(hist, 0, sizeof(*hist));
+    hist->fd = -1;
+}
+
+int history_append(history_t *hist, int sensor, uint32_t time, float temperature,
+    float humidity, int status) {
+    if(hist == NULL || hist->header == NULL) { return HISTORY_ERR_ARG; }
+    if(sensor < 0 || sensor >= HISTORY_SENSORS || time == 0) { return HISTORY_ERR_ARG; }
+
+    float t = roundf(temperature * 100.0f);
+    float h = roundf(humidity * 100.0f);
+    t = t < INT16_MIN ? INT16_MIN : t > INT16_MAX ? INT16_MAX : t;
+    h = h < 0.0f ? 0.0f : h > UINT16_MAX ? UINT16_MAX : h;
+
+    uint64_t index = hist->header->head;
+    history_record_t rec = {
+        .time = time,
+        .seq = (uint32_t) index,
+        .temperature = (int16_t) t,
+        .humidity = (uint16_t) h,
+        .sensor = (uint8_t) sensor,
+        .status = (int8_t) status,
+    };
+    rec.check = history_check(&rec);
+
+    // The record is complete before the head covers it, a torn copy fails
+    // its check and is skipped by readers and recovery
+    history_record_t *slot = &hist->records[index % hist->header->capacity];
+    *slot = rec;
+    __atomic_store_n(&hist->header->head, index + 1, __ATOMIC_RELEASE);
+
+    history_roll(hist, slot, index);
+    return HISTORY_SUCCESS;
+}
+
+int history_sync(history_t *hist) {
+    if(hist == NULL || hist->header == NULL) { return HISTORY_ERR_ARG; }
+    return msync(hist->header, hist->size, MS_SYNC) < 0 ? HISTORY_ERR_FILE : HISTORY_SUCCESS;
+}
+
+const history_record_t *history_record(const history_t *hist, uint64_t index) {
+    if(hist == NULL || hist->header == NULL) { return NULL; }
+
+    uint64_t head = __atomic_load_n(&hist->header->head, __ATOMIC_ACQUIRE);
+    if(index >= head || head - index > hist->header->capacity) { return NULL; }
+
+    const history_record_t *rec = &hist->records[index % hist->header->capacity];
+    return history_valid(rec, index) ? rec : NULL;
+}
+
+const history_bucket_t *history_bucket(const history_t *hist, int sensor,
+    history_level_e level, uint32_t time) {
+    if(hist == NULL || hist->header == NULL) { return NULL; }
+    if(sensor < 0 || sensor >= HISTORY_SENSORS || level < 0 || level >= HISTORY_LEVELS) { return NULL; }
+
+    uint32_t width = HISTORY_WIDTH[level];
+    uint32_t count = hist->header->buckets[level];
+    uint32_t start = time - time % width;
+    const history_bucket_t *bucket = &hist->buckets[level][sensor * count + (start / width) % count];
+    return bucket->start == start && bucket->count != 0 ? bucket : NULL;
+}
+
+uint32_t history_width(history_level_e level) {
+    return level >= 0 && level < HISTORY_LEVELS ? HISTORY_WIDTH[level] : 0;
+}
+//============================================================================//
@@ -0,0 +1,185 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    history.h
+ * @version v1.1.0 -- CHANGELOG
+ *                  | v1.0.0 - Added memory mapped reading history
+ *                  | v1.1.0 - Made the bucket updates undoable
+ *
+ * @note    Readings are appended as fixed width records to a ring inside a
+ *          memory mapped file. Per minute, hour and day min/max/avg buckets
+ *          are updated as each sample arrives. Buckets are direct mapped by
+ *          time, so a chart reads one bucket per point drawn straight from
+ *          the mapping.
+ *
+ *          Crash safety: a record carries a checksum and its sequence number
+ *          and is only counted once complete. Buckets remember the last
+ *          record applied to them, so records are re-applied on open
+ *          without being counted twice. A bucket saves its count and sums
+ *          and marks the record pending before changing them, an update cut
+ *          short is rolled back on open and the record applied again.
+ *
+ */
+
+#ifndef __HISTORY_H__
+#define __HISTORY_H__
+
+//===== INCLUDE ==============================================================//
+#include <stdint.h>
+//============================================================================//
+
+//===== TYPES, CONSTANTS AND VARIABLES =======================================//
+#define HISTORY_SENSORS         4
+
+typedef enum HISTORY_ERR {
+    HISTORY_ERR_FORMAT      = -3,
+    HISTORY_ERR_FILE        = -2,
+    HISTORY_ERR_ARG         = -1,
+    HISTORY_SUCCESS         = 0
+} history_err_e;
+
+typedef enum HISTORY_LEVEL {
+    HISTORY_MINUTE,
+    HISTORY_HOUR,
+    HISTORY_DAY,
+    HISTORY_LEVELS
+} history_level_e;
+
+typedef struct HISTORY_RECORD {
+    uint32_t time;              // Unix time in seconds
+    uint32_t seq;               // Index of the record, low 32 bits
+    int16_t temperature;        // Hundredths of a degree
+    uint16_t humidity;          // Hundredths of a percent
+    uint8_t sensor;             // Sensor id (0..HISTORY_SENSORS-1)
+    int8_t status;              // dht_err_e of the read
+    uint16_t check;             // Fletcher-16 of the fields above
+} history_record_t;
+
+typedef struct HISTORY_BUCKET {
+    uint32_t start;             // Unix time of the bucket start, 0 if empty
+    uint32_t applied;           // Index + 1 of the last record applied
+    uint32_t count;             // Good samples in the bucket
+    int16_t t_min;
+    int16_t t_max;
+    uint16_t h_min;
+    uint16_t h_max;
+    int64_t t_sum;
+    uint64_t h_sum;
+    uint32_t pending;           // Index + 1 of the record being applied
+    uint32_t undo_count;        // Count and sums before it
+    int64_t undo_t_sum;
+    uint64_t undo_h_sum;
+} history_bucket_t;
+
+typedef struct HISTORY_HEADER {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t sensors;
+    uint32_t capacity;          // Records in the ring
+    uint32_t buckets[HISTORY_LEVELS];
+    uint64_t head;              // Records written since creation
+} history_header_t;
+
+typedef struct HISTORY {
+    int fd;
+    uint64_t size;
+    history_header_t *header;
+    history_record_t *records;
+    history_bucket_t *buckets[HISTORY_LEVELS];
+} history_t;
+//============================================================================//
+
+//===== FUNCTION DECLARATION =================================================//
+/*!
+ * @brief Opens a history file, creating it if missing, and re-applies the
+ *        records a crash may have left out of the buckets
+ * @param [hist] history_t - History to open
+ * @param [path] char - File path
+ * @param [capacity] uint32_t - Records kept in the ring when creating
+ * @return 0 if success else negative values for various possible errors
+ */
+int history_open(history_t *hist, const char *path, uint32_t capacity);
+
+/*!
+ * @brief Unmaps and closes a history file
+ * @param [hist] history_t - History to close
+ * @return None
+ */
+void history_close(history_t *hist);
+
+/*!
+ * @brief Appends a reading and updates the minute, hour and day buckets.
+ *        Failed reads are recorded but left out of the buckets.
+ * @param [hist] history_t - History to append to
+ * @param [sensor] int - Sensor id (0..HISTORY_SENSORS-1)
+ * @param [time] uint32_t - Unix time of the reading
+ * @param [temperature] float - Temperature in degrees
+ * @param [humidity] float - Humidity in percent
+ * @param [status] int - dht_err_e of the read
+ * @return 0 if success else negative values for various possible errors
+ */
+int history_append(history_t *hist, int sensor, uint32_t time, float temperature,
+    float humidity, int status);
+
+/*!
+ * @brief Flushes the mapping to disk
+ * @param [hist] history_t - History to flush
+ * @return 0 if success else negative values for various possible errors
+ */
+int history_sync(history_t *hist);
+
+/*!
+ * @brief Get a record of the ring
+ * @param [hist] history_t - History to read
+ * @param [index] uint64_t - Record index, valid for the last capacity records
+ * @return Pointer into the mapping or NULL if overwritten or damaged
+ */
+const history_record_t *history_record(const history_t *hist, uint64_t index);
+
+/*!
+ * @brief Get the bucket covering a time
+ * @param [hist] history_t - History to read
+ * @param [sensor] int - Sensor id (0..HISTORY_SENSORS-1)
+ * @param [level] history_level_e - Bucket width
+ * @param [time] uint32_t - Unix time inside the bucket
+ * @return Pointer into the mapping or NULL if the bucket has no sample
+ */
+const history_bucket_t *history_bucket(const history_t *hist, int sensor,
+    history_level_e level, uint32_t time);
+
+/*!
+ * @brief Get the width of the buckets of a level
+ * @param [level] history_level_e - Bucket level
+ * @return [uint32_t] Width in seconds
+ */
+uint32_t history_width(history_level_e level);
+
+/*!
+ * @brief Get the average temperature of a bucket
+ * @param [bucket] history_bucket_t - Non empty bucket
+ * @return [float] Temperature in degrees
+ */
+static inline float history_temperature(const history_bucket_t *bucket) {
+    return (float) bucket->t_sum / bucket->count / 100.0f;
+}
+
+/*!
+ * @brief Get the average humidity of a bucket
+ * @param [bucket] history_bucket_t - Non empty bucket
+ * @return [float] Humidity in percent
+ */
+static inline float history_humidity(const history_bucket_t *bucket) {
+    return (float) bucket->h_sum / bucket->count / 100.0f;
+}
+//============================================================================//
+
+#endif //__HISTORY_H__
@@ -0,0 +1,336 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    loop.c
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added epoll event loop with a timer wheel
+ *
+ * @note    This is a library written in standard C to run the jobs of the
+ *          mirror from one thread
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <errno.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "loop.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+static const uint64_t LOOP_SLOT_MASK = LOOP_SLOTS - 1;
+static const uint64_t LOOP_NONE = UINT64_MAX;
+
+// Ticks the wheel spans, timers further out are parked at its end
+static const uint64_t LOOP_SPAN = 1ULL << (LOOP_SLOT_BITS * LOOP_LEVELS);
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static uint64_t loop_clock_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+static uint64_t loop_rotate(uint64_t map, unsigned int n) {
+    return (map >> n) | (map << ((64 - n) & 63));
+}
+
+static uint64_t loop_round(uint64_t due, uint32_t slack) {
+    // Of the ticks in [due, due + slack] the one with the most trailing zeros,
+    // timers with overlapping windows then agree on it
+    if(slack == 0 || due == 0) { return due; }
+    uint64_t last = due + slack;
+    int bit = 63 - __builtin_clzll((due - 1) ^ last);
+    return last & ~((1ULL << bit) - 1);
+}
+
+static void wheel_link(loop_t *loop, loop_timer_t *timer) {
+    uint64_t expires = timer->expires > loop->tick ? timer->expires : loop->tick;
+    uint64_t delta = expires - loop->tick;
+    if(delta >= LOOP_SPAN) {
+        expires = loop->tick + LOOP_SPAN - 1;
+        delta = LOOP_SPAN - 1;
+    }
+
+    int level = 0;
+    while(delta >> (LOOP_SLOT_BITS * (level + 1)) != 0) { level++; }
+    unsigned int slot = (unsigned int) ((expires >> (LOOP_SLOT_BITS * level)) & LOOP_SLOT_MASK);
+
+    loop_timer_t **head = &loop->slots[level][slot];
+    timer->next = *head;
+    if(*head != NULL) { (*head)->pprev = &timer->next; }
+    *head = timer;
+    timer->pprev = head;
+    timer->level = (uint8_t) level;
+    timer->slot = (uint8_t) slot;
+    loop->map[level] |= 1ULL << slot;
+    loop->timers++;
+}
+
+static void wheel_unlink(loop_t *loop, loop_timer_t *timer) {
+    *timer->pprev = timer->next;
+    if(timer->next != NULL) { timer->next->pprev = timer->pprev; }
+    timer->next = NULL;
+    timer->pprev = NULL;
+    loop->timers--;
+
+    // Timers being expired were taken off the wheel already
+    if(timer->level < LOOP_LEVELS && loop->slots[timer->level][timer->slot] == NULL) {
+        loop->map[timer->level] &= ~(1ULL << timer->slot);
+    }
+}
+
+static uint64_t wheel_at(const loop_t *loop, int level, unsigned int *slot) {
+    // A level moves its next slot down when the ticks below it wrap, the
+    // slots in between are passed over by their bitmap
+    const unsigned int shift = LOOP_SLOT_BITS * (unsigned int) level;
+    uint64_t block = (loop->tick + (1ULL << shift) - 1) >> shift;
+    unsigned int pos = (unsigned int) (block & LOOP_SLOT_MASK);
+    unsigned int skip = (unsigned int) __builtin_ctzll(loop_rotate(loop->map[level], pos));
+    *slot = (pos + skip) & LOOP_SLOT_MASK;
+    return (block + skip) << shift;
+}
+
+static uint64_t wheel_next(const loop_t *loop) {
+    // Next tick where a slot expires or moves down
+    uint64_t next = LOOP_NONE;
+    for(int level = 0; level < LOOP_LEVELS; level++) {
+        if(loop->map[level] == 0) { continue; }
+        unsigned int slot;
+        uint64_t at = wheel_at(loop, level, &slot);
+        if(at < next) { next = at; }
+    }
+    return next;
+}
+
+static uint64_t wheel_expiry(const loop_t *loop) {
+    // Level 0 slots expire when they come up. Higher slots hold a range of
+    // ticks, only the earliest of the next one matters and only if it can
+    // come before what was found below.
+    uint64_t expiry = LOOP_NONE;
+    for(int level = 0; level < LOOP_LEVELS; level++) {
+        if(loop->map[level] == 0) { continue; }
+        unsigned int slot;
+        uint64_t at = wheel_at(loop, level, &slot);
+        if(at >= expiry) { continue; }
+        if(level == 0) {
+            expiry = at;
+            continue;
+        }
+        for(const loop_timer_t *timer = loop->slots[level][slot]; timer != NULL; timer = timer->next) {
+            if(timer->expires < expiry) { expiry = timer->expires > at ? timer->expires : at; }
+        }
+    }
+    return expiry;
+}
+
+static void wheel_cascade(loop_t *loop, int level, unsigned int slot) {
+    loop_timer_t *timer = loop->slots[level][slot];
+    loop->slots[level][slot] = NULL;
+    loop->map[level] &= ~(1ULL << slot);
+
+    while(timer != NULL) {
+        loop_timer_t *next = timer->next;
+        loop->timers--;
+        wheel_link(loop, timer);
+        timer = next;
+    }
+}
+
+static void wheel_expire(loop_t *loop, unsigned int slot) {
+    // The slot is moved to a local list first, callbacks may then stop any
+    // of the timers still in it or start new ones in the same slot
+    loop_timer_t *head = loop->slots[0][slot];
+    if(head == NULL) { return; }
+    loop->slots[0][slot] = NULL;
+    loop->map[0] &= ~(1ULL << slot);
+    head->pprev = &head;
+    for(loop_timer_t *timer = head; timer != NULL; timer = timer->next) { timer->level = LOOP_LEVELS; }
+
+    while(head != NULL) {
+        loop_timer_t *timer = head;
+        wheel_unlink(loop, timer);
+        if(timer->expires > loop->tick) {
+            wheel_link(loop, timer);
+            continue;
+        }
+
+        if(timer->period_ms != 0) {
+            // Periods missed while the loop was busy are skipped, not queued
+            timer->due += timer->period_ms;
+            if(timer->due < loop->tick) {
+                timer->due += (loop->tick - timer->due + timer->period_ms - 1) / timer->period_ms * timer->period_ms;
+            }
+            timer->expires = loop_round(timer->due, timer->slack_ms);
+            wheel_link(loop, timer);
+        }
+
+        loop->fired++;
+        timer->fn(loop, timer);
+    }
+}
+
+static void wheel_advance(loop_t *loop, uint64_t now) {
+    uint64_t next;
+    while((next = wheel_next(loop)) <= now) {
+        loop->tick = next;
+        for(int level = 1; level < LOOP_LEVELS; level++) {
+            const unsigned int shift = LOOP_SLOT_BITS * (unsigned int) level;
+            if((next & ((1ULL << shift) - 1)) != 0) { break; }
+            wheel_cascade(loop, level, (unsigned int) ((next >> shift) & LOOP_SLOT_MASK));
+        }
+        wheel_expire(loop, (unsigned int) (next & LOOP_SLOT_MASK));
+        loop->tick = next + 1;
+    }
+    if(loop->tick <= now) { loop->tick = now + 1; }
+}
+
+static int loop_arm(loop_t *loop) {
+    uint64_t expiry = wheel_expiry(loop);
+    if(expiry == loop->armed) { return LOOP_SUCCESS; }
+
+    struct itimerspec spec;
+    memset(&spec, 0, sizeof(spec));
+    if(expiry != LOOP_NONE) {
+        uint64_t ns = loop->start_ns + expiry * 1000000ULL;
+        spec.it_value.tv_sec = (time_t) (ns / 1000000000ULL);
+        spec.it_value.tv_nsec = (long) (ns % 1000000000ULL);
+    }
+    if(timerfd_settime(loop->tfd, TFD_TIMER_ABSTIME, &spec, NULL) < 0) { return LOOP_ERR_SYSTEM; }
+
+    loop->armed = expiry;
+    return LOOP_SUCCESS;
+}
+
+int loop_init(loop_t *loop) {
+    if(loop == NULL) { return LOOP_ERR_ARG; }
+    memset(loop, 0, sizeof(*loop));
+    loop->armed = LOOP_NONE;
+    loop->start_ns = loop_clock_ns();
+
+    loop->epfd = epoll_create1(EPOLL_CLOEXEC);
+    loop->tfd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+
+    // The timerfd is told apart from the watches by its missing pointer
+    struct epoll_event event = { .events = EPOLLIN, .data.ptr = NULL };
+    if(loop->epfd < 0 || loop->tfd < 0 || epoll_ctl(loop->epfd, EPOLL_CTL_ADD, loop->tfd, &event) < 0) {
+        loop_close(loop);
+        return LOOP_ERR_SYSTEM;
+    }
+    return LOOP_SUCCESS;
+}
+
+void loop_close(loop_t *loop) {
+    if(loop == NULL) { return; }
+    if(loop->tfd >= 0) { close(loop->tfd); }
+    if(loop->epfd >= 0) { close(loop->epfd); }
+    loop->tfd = -1;
+    loop->epfd = -1;
+}
+
+uint64_t loop_now(const loop_t *loop) {
+    return (loop_clock_ns() - loop->start_ns) / 1000000ULL;
+}
+
+void loop_timer_init(loop_timer_t *timer, loop_timer_fn fn, void *arg) {
+    memset(timer, 0, sizeof(*timer));
+    timer->fn = fn;
+    timer->arg = arg;
+}
+
+void loop_timer_start(loop_t *loop, loop_timer_t *timer, uint32_t delay_ms, uint32_t period_ms,
+    uint32_t slack_ms) {
+    if(loop == NULL || timer == NULL || timer->fn == NULL) { return; }
+    if(timer->pprev != NULL) { wheel_unlink(loop, timer); }
+
+    timer->due = loop_now(loop) + delay_ms;
+    timer->period_ms = period_ms;
+    timer->slack_ms = slack_ms;
+    timer->expires = loop_round(timer->due, slack_ms);
+    wheel_link(loop, timer);
+}
+
+void loop_timer_stop(loop_t *loop, loop_timer_t *timer) {
+    if(loop == NULL || timer == NULL || timer->pprev == NULL) { return; }
+    wheel_unlink(loop, timer);
+}
+
+int loop_timer_pending(const loop_timer_t *timer) {
+    return timer != NULL && timer->pprev != NULL;
+}
+
+int loop_watch(loop_t *loop, loop_watch_t *watch, int fd, uint32_t events, loop_watch_fn fn, void *arg) {
+    if(loop == NULL || watch == NULL || fd < 0 || fn == NULL) { return LOOP_ERR_ARG; }
+
+    watch->fd = fd;
+    watch->fn = fn;
+    watch->arg = arg;
+    struct epoll_event event = { .events = events, .data.ptr = watch };
+    if(epoll_ctl(loop->epfd, EPOLL_CTL_ADD, fd, &event) < 0) {
+        watch->fd = -1;
+        return LOOP_ERR_SYSTEM;
+    }
+    return LOOP_SUCCESS;
+}
+
+void loop_unwatch(loop_t *loop, loop_watch_t *watch) {
+    if(loop == NULL || watch == NULL || watch->fd < 0) { return; }
+
+    // Events of this pass already returned for it are skipped by the -1
+    epoll_ctl(loop->epfd, EPOLL_CTL_DEL, watch->fd, NULL);
+    watch->fd = -1;
+}
+
+int loop_once(loop_t *loop) {
+    if(loop == NULL) { return LOOP_ERR_ARG; }
+    if(loop_arm(loop) != LOOP_SUCCESS) { return LOOP_ERR_SYSTEM; }
+
+    struct epoll_event events[LOOP_EVENTS_MAX];
+    int ready = epoll_wait(loop->epfd, events, LOOP_EVENTS_MAX, -1);
+    if(ready < 0) { return errno == EINTR ? LOOP_SUCCESS : LOOP_ERR_SYSTEM; }
+    loop->wakeups++;
+
+    for(int i = 0; i < ready; i++) {
+        loop_watch_t *watch = events[i].data.ptr;
+        if(watch == NULL) {
+            uint64_t expirations;
+            if(read(loop->tfd, &expirations, sizeof(expirations)) > 0) { loop->armed = LOOP_NONE; }
+            continue;
+        }
+        if(watch->fd >= 0) { watch->fn(loop, watch, events[i].events); }
+    }
+
+    // Everything due by now runs in this pass, whether it woke the loop or not
+    wheel_advance(loop, loop_now(loop));
+    return LOOP_SUCCESS;
+}
+
+int loop_run(loop_t *loop) {
+    if(loop == NULL) { return LOOP_ERR_ARG; }
+
+    loop->running = 1;
+    while(loop->running) {
+        int result = loop_once(loop);
+        if(result != LOOP_SUCCESS) { return result; }
+    }
+    return LOOP_SUCCESS;
+}
+
+void loop_stop(loop_t *loop) {
+    if(loop != NULL) { loop->running = 0; }
+}
+//============================================================================//
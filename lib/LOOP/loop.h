@@ -0,0 +1,198 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    loop.h
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added epoll event loop with a timer wheel
+ *
+ * @note    One thread waits in epoll on the watched file descriptors and a
+ *          single timerfd. Timers live in a hierarchical wheel of
+ *          LOOP_LEVELS levels of 64 slots with a 1 ms tick:
+ *          - start and stop link or unlink a timer, O(1) with no allocation
+ *          - a bitmap per level finds the next occupied slot, so the
+ *            timerfd is armed for the earliest expiry and the thread sleeps
+ *            until then, however many timers are pending
+ *          - timers further out move down a level once their slot comes up
+ *          A timer may expire up to its slack after its deadline. Expiries
+ *          are rounded within that slack to the coarsest millisecond, so
+ *          deadlines close to each other expire on the same tick and cost
+ *          one wakeup.
+ *
+ *          Timer and watch structures belong to the caller and must stay in
+ *          place while started. Callbacks may start and stop any timer.
+ *
+ */
+
+#ifndef __LOOP_H__
+#define __LOOP_H__
+
+//===== INCLUDE ==============================================================//
+#include <stdint.h>
+//============================================================================//
+
+//===== TYPES, CONSTANTS AND VARIABLES =======================================//
+#define LOOP_LEVELS             4
+#define LOOP_SLOT_BITS          6
+#define LOOP_SLOTS              (1 << LOOP_SLOT_BITS)
+#define LOOP_EVENTS_MAX         16
+
+typedef enum LOOP_ERR {
+    LOOP_ERR_SYSTEM         = -2,
+    LOOP_ERR_ARG            = -1,
+    LOOP_SUCCESS            = 0
+} loop_err_e;
+
+typedef struct LOOP loop_t;
+typedef struct LOOP_TIMER loop_timer_t;
+typedef struct LOOP_WATCH loop_watch_t;
+
+typedef void (*loop_timer_fn)(loop_t *loop, loop_timer_t *timer);
+typedef void (*loop_watch_fn)(loop_t *loop, loop_watch_t *watch, uint32_t events);
+
+struct LOOP_TIMER {
+    loop_timer_t *next;
+    loop_timer_t **pprev;       // Link pointing at this timer, NULL if idle
+    uint8_t level;              // Wheel slot holding the timer
+    uint8_t slot;
+    uint64_t due;               // Deadline in ticks
+    uint64_t expires;           // Deadline rounded within the slack
+    uint32_t period_ms;         // 0 for a one shot timer
+    uint32_t slack_ms;
+    loop_timer_fn fn;
+    void *arg;
+};
+
+struct LOOP_WATCH {
+    int fd;                     // -1 once unwatched
+    loop_watch_fn fn;
+    void *arg;
+};
+
+struct LOOP {
+    int epfd;
+    int tfd;                    // timerfd armed for the earliest expiry
+    int running;
+    uint64_t start_ns;          // CLOCK_MONOTONIC time of tick 0
+    uint64_t tick;              // Next tick the wheel processes
+    uint64_t armed;             // Tick the timerfd is armed for, or UINT64_MAX
+    uint64_t map[LOOP_LEVELS];  // Occupied slots of each level
+    loop_timer_t *slots[LOOP_LEVELS][LOOP_SLOTS];
+    uint32_t timers;            // Pending timers
+    uint64_t wakeups;           // Returns from epoll since init
+    uint64_t fired;             // Timer callbacks since init
+};
+//============================================================================//
+
+//===== FUNCTION DECLARATION =================================================//
+/*!
+ * @brief Creates the epoll instance and timerfd of a loop
+ * @param [loop] loop_t - Loop to initialize
+ * @return 0 if success else negative values for various possible errors
+ */
+int loop_init(loop_t *loop);
+
+/*!
+ * @brief Closes a loop, pending timers and watches are dropped
+ * @param [loop] loop_t - Loop to close
+ * @return None
+ */
+void loop_close(loop_t *loop);
+
+/*!
+ * @brief Milliseconds elapsed since the loop was initialized
+ * @param [loop] loop_t - Loop
+ * @return [uint64_t] Current tick
+ */
+uint64_t loop_now(const loop_t *loop);
+
+/*!
+ * @brief Prepares a timer, it stays idle until started
+ * @param [timer] loop_timer_t - Timer to initialize
+ * @param [fn] loop_timer_fn - Called on the loop thread at each expiry
+ * @param [arg] void - Passed along in timer->arg
+ * @return None
+ */
+void loop_timer_init(loop_timer_t *timer, loop_timer_fn fn, void *arg);
+
+/*!
+ * @brief Starts or restarts a timer
+ * @param [loop] loop_t - Loop
+ * @param [timer] loop_timer_t - Timer to start
+ * @param [delay_ms] uint32_t - Time until the first expiry
+ * @param [period_ms] uint32_t - Time between later expiries, 0 for one shot
+ * @param [slack_ms] uint32_t - Lateness allowed to share a wakeup
+ * @return None
+ *
+ * @note Periods are kept from the deadlines, expiries do not drift
+ */
+void loop_timer_start(loop_t *loop, loop_timer_t *timer, uint32_t delay_ms, uint32_t period_ms,
+    uint32_t slack_ms);
+
+/*!
+ * @brief Stops a timer, nothing happens if it is idle
+ * @param [loop] loop_t - Loop
+ * @param [timer] loop_timer_t - Timer to stop
+ * @return None
+ */
+void loop_timer_stop(loop_t *loop, loop_timer_t *timer);
+
+/*!
+ * @brief Tells if a timer is started
+ * @param [timer] loop_timer_t - Timer
+ * @return 1 if it will expire else 0
+ */
+int loop_timer_pending(const loop_timer_t *timer);
+
+/*!
+ * @brief Calls back when a file descriptor becomes ready
+ * @param [loop] loop_t - Loop
+ * @param [watch] loop_watch_t - Watch to register
+ * @param [fd] int - File descriptor to watch
+ * @param [events] uint32_t - EPOLLIN, EPOLLOUT etc.
+ * @param [fn] loop_watch_fn - Called on the loop thread with the events
+ * @param [arg] void - Passed along in watch->arg
+ * @return 0 if success else negative values for various possible errors
+ */
+int loop_watch(loop_t *loop, loop_watch_t *watch, int fd, uint32_t events, loop_watch_fn fn, void *arg);
+
+/*!
+ * @brief Stops watching a file descriptor, the descriptor is not closed
+ * @param [loop] loop_t - Loop
+ * @param [watch] loop_watch_t - Watch to remove
+ * @return None
+ */
+void loop_unwatch(loop_t *loop, loop_watch_t *watch);
+
+/*!
+ * @brief Sleeps until a watch is ready or a timer is due and runs the
+ *        callbacks of everything ready by then
+ * @param [loop] loop_t - Loop
+ * @return 0 if success else negative values for various possible errors
+ */
+int loop_once(loop_t *loop);
+
+/*!
+ * @brief Runs the loop until loop_stop() is called from a callback
+ * @param [loop] loop_t - Loop
+ * @return 0 if success else negative values for various possible errors
+ */
+int loop_run(loop_t *loop);
+
+/*!
+ * @brief Makes loop_run() return after the current pass
+ * @param [loop] loop_t - Loop
+ * @return None
+ */
+void loop_stop(loop_t *loop);
+//============================================================================//
+
+#endif //__LOOP_H__
@@ -11,9 +11,12 @@
  * @author  Syed Asad Amin
  * @date    Nov 30th, 2022
  * @file    mmio.c
- * @version v1.0.0 -- CHANGELOG
+ * @version v1.3.0 -- CHANGELOG
  *                  | v1.0.0 - Added memory mapping function for GPIO access on
  *                  |           user space
+ *                  | v1.1.0 - Added pluggable mapping backends
+ *                  | v1.2.0 - Added multi pin port access
+ *                  | v1.3.0 - Trace point on gpio lookups
  * 
  * @note    This library is written in C for Beagle Bone Black platform to map
  *          the GPIO for various user activities
@@ -29,8 +32,10 @@
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <unistd.h>
 
 #include "mmio.h"
+#include "trace.h"
 //============================================================================//
 
 //===== CONSTANTS AND VARIABLES ==============================================//
@@ -58,9 +63,46 @@ static const uint32_t gpio_addr[4] = {
 
 // Cache memory-mapped GPIO addresses
 static volatile uint32_t *gpio_base[4] = { NULL };
+
+static int devmem_map(int base, volatile uint32_t **regs);
+static void devmem_unmap(int base, volatile uint32_t *regs);
+
+const mmio_backend_t MMIO_BACKEND_DEVMEM = {
+    .name = "devmem",
+    .map = devmem_map,
+    .unmap = devmem_unmap
+};
+
+// Backend used to map the banks
+static const mmio_backend_t *backend = &MMIO_BACKEND_DEVMEM;
 //============================================================================//
 
 //===== FUNCTION DEFINITION ==================================================//
+static int devmem_map(int base, volatile uint32_t **regs) {
+    int fd = open(DEV_MEM_LOC, O_RDWR | O_SYNC);
+    if(fd == -1) { return MMIO_ERR_DEVMEM; }            // Try running as root
+
+    // Mapping GPIO memory location for user processing
+    void *mem = mmap(
+        NULL,
+        GPIO_LEN,
+        PROT_READ | PROT_WRITE,
+        MAP_SHARED,
+        fd,
+        gpio_addr[base]
+    );
+    close(fd);
+
+    if(mem == MAP_FAILED) { return MMIO_ERR_MMAP; }
+
+    *regs = (volatile uint32_t *) mem;
+    return MMIO_SUCCESS;
+}
+
+static void devmem_unmap(int base, volatile uint32_t *regs) {
+    munmap((void *) regs, GPIO_LEN);
+}
+
 int mmio_get_gpio(int base, int num, gpio_t *gpio) {
     // Input check for possible args error
     if(gpio == NULL) { return MMIO_ERR_ARG; }
@@ -68,32 +110,51 @@ int mmio_get_gpio(int base, int num, gpio_t *gpio) {
     if(num < 0 || num > 31) { return MMIO_ERR_ARG; }
 
     // Map GPIO memory if not already mapped
+    TRACE_BEGIN("mmio_get_gpio");
     if(gpio_base[base] == NULL) {
-        int fd = open(DEV_MEM_LOC, O_RDWR, O_SYNC);
-        if(fd == -1) { return MMIO_ERR_DEVMEM; }        // Try running as root     
-
-        // Mapping GPIO memory location for user processing
-        gpio_base[base] = (uint32_t *) mmap(
-            NULL,
-            GPIO_LEN,
-            PROT_READ | PROT_WRITE,
-            MAP_SHARED,
-            fd,
-            gpio_addr[base]
-        );
+        int result = backend->map(base, &gpio_base[base]);
 
         // Clearing the cache if memory mapping failed
-        if(gpio_base[base] == MAP_FAILED) {
+        if(result < 0) {
             gpio_base[base] = NULL;
-            return MMIO_ERR_MMAP;
+            TRACE_END("mmio_get_gpio");
+            return result;
         }
     }
 
     // Setting up the gpio field from memory
-    memset(gpio, 0, sizeof(gpio));
+    memset(gpio, 0, sizeof(*gpio));
     gpio->base = gpio_base[base];
     gpio->num = num;
 
+    TRACE_END("mmio_get_gpio");
     return MMIO_SUCCESS;
 }
+
+int mmio_get_port(int base, uint32_t mask, gpio_port_t *port) {
+    if(port == NULL || mask == 0) { return MMIO_ERR_ARG; }
+
+    // Mapping is shared with the single pin access
+    gpio_t gpio;
+    int result = mmio_get_gpio(base, __builtin_ctz(mask), &gpio);
+    if(result < 0) { return result; }
+
+    port->base = gpio.base;
+    port->mask = mask;
+    return MMIO_SUCCESS;
+}
+
+void mmio_set_backend(const mmio_backend_t *next) {
+    if(next == NULL) { next = &MMIO_BACKEND_DEVMEM; }
+
+    // Release the banks mapped through the previous backend
+    for(int i = 0; i < 4; i++) {
+        if(gpio_base[i] != NULL) {
+            backend->unmap(i, gpio_base[i]);
+            gpio_base[i] = NULL;
+        }
+    }
+
+    backend = next;
+}
 //============================================================================//
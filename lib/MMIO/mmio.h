@@ -11,9 +11,12 @@
  * @author  Syed Asad Amin
  * @date    Nov 30th, 2022
  * @file    mmio.h
- * @version v1.0.0 -- CHANGELOG
+ * @version v1.3.0 -- CHANGELOG
  *                  | v1.0.0 - Added memory mapping function for GPIO access on
  *                  |           user space
+ *                  | v1.1.0 - Added pluggable mapping backends
+ *                  | v1.2.0 - Added multi pin port access
+ *                  | v1.3.0 - Made usable from C++ (see mmio.hpp)
  * 
  * @note    This library is written in C for Beagle Bone Black platform to map
  *          the GPIO for various user activities
@@ -29,6 +32,10 @@
 #include <stdint.h>
 //============================================================================//
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 //===== TYPES, CONSTANTS AND VARIABLES =======================================//
 typedef enum GPIO_LVL {
     LOW,
@@ -52,6 +59,23 @@ typedef struct GPIO {
     volatile uint32_t *base;
     uint8_t num;
 } gpio_t;
+
+typedef struct GPIO_PORT {
+    volatile uint32_t *base;
+    uint32_t mask;
+} gpio_port_t;
+
+/*!
+ * @brief Mapping backend used by mmio_get_gpio to obtain the register file of
+ *        a gpio bank. The default backend maps the AM335x banks from /dev/mem.
+ */
+typedef struct MMIO_BACKEND {
+    const char *name;
+    int (*map)(int base, volatile uint32_t **regs);
+    void (*unmap)(int base, volatile uint32_t *regs);
+} mmio_backend_t;
+
+extern const mmio_backend_t MMIO_BACKEND_DEVMEM;
 //============================================================================//
 
 //===== FUNCTION DECLARATION =================================================//
@@ -65,6 +89,24 @@ typedef struct GPIO {
  */
 int mmio_get_gpio(int base, int num, gpio_t *gpio);
 
+/*!
+ * @brief Get several pins of one gpio bank to access them together
+ * @param [base] int - Gpio base (0..3)
+ * @param [mask] uint32_t - Pins of the bank (bit n for GPIO number n)
+ * @param [gpio_port_t] port - Output of mapped port
+ * @return 0 if success else negative values for various possible errors
+ */
+int mmio_get_port(int base, uint32_t mask, gpio_port_t *port);
+
+/*!
+ * @brief Selects the backend used to map gpio banks. Banks mapped by the
+ *        previous backend are released, so gpio_t handles obtained earlier
+ *        must not be used afterwards.
+ * @param [backend] mmio_backend_t - Backend to use, NULL restores /dev/mem
+ * @return None
+ */
+void mmio_set_backend(const mmio_backend_t *backend);
+
 /*!
  * @brief Sets the GPIO as input mode
  * @param [gpio_t] gpio - GPIO to be set as input
@@ -123,6 +165,55 @@ static inline void mmio_set_level(gpio_t gpio, int lvl) {
 static inline uint32_t mmio_input(gpio_t gpio) {
     return gpio.base[MMIO_IO_DATAIN / 4] & (1 << gpio.num);
 }
+
+/*!
+ * @brief Sets the pins of a port as input mode
+ * @param [gpio_port_t] port - Pins to be set as input
+ * @return None
+ */
+static inline void mmio_port_set_input(gpio_port_t port) {
+    port.base[MMIO_OE_ADDR / 4] |= port.mask;
+}
+
+/*!
+ * @brief Sets the pins of a port as output mode
+ * @param [gpio_port_t] port - Pins to be set as output
+ * @return None
+ */
+static inline void mmio_port_set_output(gpio_port_t port) {
+    port.base[MMIO_OE_ADDR / 4] &= ~port.mask;
+}
+
+/*!
+ * @brief Sets the pins of a port to low level with a single write
+ * @param [gpio_port_t] port - Pins to be set at low level
+ * @return None
+ */
+static inline void mmio_port_set_low(gpio_port_t port) {
+    port.base[MMIO_IO_CLR_DATAOUT / 4] = port.mask;
+}
+
+/*!
+ * @brief Sets the pins of a port to high level with a single write
+ * @param [gpio_port_t] port - Pins to be set at high level
+ * @return None
+ */
+static inline void mmio_port_set_high(gpio_port_t port) {
+    port.base[MMIO_IO_SET_DATAOUT / 4] = port.mask;
+}
+
+/*!
+ * @brief Get the input state of the pins of a port with a single read
+ * @param [gpio_port_t] port - Pins to read
+ * @return [uint32_t] Levels of the pins, masked
+ */
+static inline uint32_t mmio_port_input(gpio_port_t port) {
+    return port.base[MMIO_IO_DATAIN / 4] & port.mask;
+}
 //============================================================================//
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif //__MMIO_H__
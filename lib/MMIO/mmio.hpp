@@ -0,0 +1,136 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    mmio.hpp
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added compile time pin and port templates
+ *
+ * @note    C++ layer over mmio.h. Bank, register offsets and masks are
+ *          template arguments, so every access is a single load or store at
+ *          a constant offset from the mapped bank. Several pins of a bank are
+ *          driven with one SETDATAOUT/CLEARDATAOUT write.
+ *
+ *          using Led = mmio::Pin<1, 21>;
+ *          using Leds = mmio::Pins<mmio::Pin<1, 21>, mmio::Pin<1, 22>>;
+ *          Leds::map(); Leds::set_output(); Leds::high();
+ *
+ *          Banks are mapped through mmio_get_gpio(), map() must be called
+ *          again after mmio_set_backend().
+ *
+ * @sa      doc/..Technical_Reference_Manual.pdf
+ *
+ */
+
+#ifndef __MMIO_HPP__
+#define __MMIO_HPP__
+
+//===== INCLUDE ==============================================================//
+#include <cstdint>
+
+#include "mmio.h"
+//============================================================================//
+
+//===== TYPES, CONSTANTS AND VARIABLES =======================================//
+namespace mmio {
+
+/*!
+ * @brief Register file of one gpio bank, mapped once and shared by every
+ *        pin and port of the bank
+ */
+template <int Bank>
+struct GpioBank {
+    static_assert(Bank >= 0 && Bank < 4, "AM335x has gpio banks 0..3");
+
+    static inline volatile uint32_t *regs = nullptr;
+
+    static int map() {
+        gpio_t gpio;
+        int result = mmio_get_gpio(Bank, 0, &gpio);
+        if(result == MMIO_SUCCESS) { regs = gpio.base; }
+        return result;
+    }
+
+    template <uint32_t Offset>
+    static volatile uint32_t &reg() {
+        static_assert(Offset % 4 == 0, "Registers are 32 bit aligned");
+        return regs[Offset / 4];
+    }
+};
+
+/*!
+ * @brief Pins of one gpio bank accessed together
+ */
+template <int Bank, uint32_t Mask>
+struct Port {
+    static_assert(Mask != 0, "A port needs at least one pin");
+
+    using bank = GpioBank<Bank>;
+    static constexpr int base = Bank;
+    static constexpr uint32_t mask = Mask;
+
+    static int map() { return bank::map(); }
+
+    // OE has no set/clear alias, one read-modify-write covers all pins
+    static void set_input() { bank::template reg<MMIO_OE_ADDR>() |= Mask; }
+    static void set_output() { bank::template reg<MMIO_OE_ADDR>() &= ~Mask; }
+
+    static void high() { bank::template reg<MMIO_IO_SET_DATAOUT>() = Mask; }
+    static void low() { bank::template reg<MMIO_IO_CLR_DATAOUT>() = Mask; }
+
+    /*!
+     * @brief Drives every pin of the port to its bit of value, one SET and
+     *        one CLEAR write, pins outside the port are untouched
+     */
+    static void write(uint32_t value) {
+        bank::template reg<MMIO_IO_SET_DATAOUT>() = value & Mask;
+        bank::template reg<MMIO_IO_CLR_DATAOUT>() = ~value & Mask;
+    }
+
+    static uint32_t read() { return bank::template reg<MMIO_IO_DATAIN>() & Mask; }
+
+    static gpio_port_t c_port() { return gpio_port_t { bank::regs, Mask }; }
+};
+
+/*!
+ * @brief Single pin of a gpio bank
+ */
+template <int Bank, int Num>
+struct Pin : Port<Bank, UINT32_C(1) << Num> {
+    static_assert(Num >= 0 && Num < 32, "GPIO numbers are 0..31");
+
+    static constexpr int num = Num;
+
+    static void set(int lvl) {
+        if(lvl == LOW) {
+            Pin::low();
+        } else {
+            Pin::high();
+        }
+    }
+
+    static bool level() { return Pin::read() != 0; }
+
+    static gpio_t c_gpio() { return gpio_t { GpioBank<Bank>::regs, static_cast<uint8_t>(Num) }; }
+};
+
+/*!
+ * @brief Port made of the given pins, which must share a bank
+ */
+template <typename First, typename... Rest>
+struct Pins : Port<First::base, (First::mask | ... | Rest::mask)> {
+    static_assert(((First::base == Rest::base) && ...), "Pins of a port must share a bank");
+};
+
+}   // namespace mmio
+//============================================================================//
+
+#endif //__MMIO_HPP__
@@ -0,0 +1,139 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    mmio_sim.c
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added simulated GPIO register file backend
+ *
+ * @note    This library is written in C to run the GPIO dependent code on
+ *          hosts without the AM335x gpio banks
+ *
+ * @sa      doc/..Technical_Reference_Manual.pdf
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "mmio_sim.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+static const uint32_t GPIO_LEN              = 4096;
+static const uint32_t GPIO_BANKS            = 4;
+
+static int sim_map(int base, volatile uint32_t **regs);
+static void sim_unmap(int base, volatile uint32_t *regs);
+
+const mmio_backend_t MMIO_BACKEND_SIM = {
+    .name = "sim",
+    .map = sim_map,
+    .unmap = sim_unmap
+};
+
+// Register file shared by all simulated banks
+static pthread_once_t sim_once = PTHREAD_ONCE_INIT;
+static int sim_memfd = -1;
+static volatile uint32_t *sim_mem = NULL;
+
+// Lines pulled low by simulated devices on each bank
+static uint32_t sim_pull_low[4] = { 0 };
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static void sim_create(void) {
+    int fd = memfd_create("mmio_sim", MFD_CLOEXEC);
+    if(fd == -1) { return; }
+
+    if(ftruncate(fd, GPIO_LEN * GPIO_BANKS) == -1) {
+        close(fd);
+        return;
+    }
+
+    void *mem = mmap(
+        NULL,
+        GPIO_LEN * GPIO_BANKS,
+        PROT_READ | PROT_WRITE,
+        MAP_SHARED,
+        fd,
+        0
+    );
+    if(mem == MAP_FAILED) {
+        close(fd);
+        return;
+    }
+
+    // Reset state of the banks, every pin is an input pulled high
+    volatile uint32_t *regs = (volatile uint32_t *) mem;
+    for(uint32_t i = 0; i < GPIO_BANKS; i++) {
+        volatile uint32_t *bank = regs + i * (GPIO_LEN / 4);
+        bank[MMIO_OE_ADDR / 4] = 0xFFFFFFFF;
+        bank[MMIO_IO_DATAIN / 4] = 0xFFFFFFFF;
+    }
+
+    sim_memfd = fd;
+    sim_mem = regs;
+}
+
+static volatile uint32_t *sim_bank(int base) {
+    pthread_once(&sim_once, sim_create);
+    if(sim_mem == NULL) { return NULL; }
+    return sim_mem + base * (GPIO_LEN / 4);
+}
+
+static int sim_map(int base, volatile uint32_t **regs) {
+    volatile uint32_t *bank = sim_bank(base);
+    if(bank == NULL) { return MMIO_ERR_MMAP; }
+
+    *regs = bank;
+    return MMIO_SUCCESS;
+}
+
+static void sim_unmap(int base, volatile uint32_t *regs) {
+    // Register file stays mapped so devices keep their state across backends
+}
+
+uint32_t mmio_sim_sync(int base) {
+    volatile uint32_t *bank = sim_bank(base);
+    if(bank == NULL) { return 0; }
+
+    // Consume pending writes, exchanging so no store of the host is lost
+    uint32_t set = __atomic_exchange_n(&bank[MMIO_IO_SET_DATAOUT / 4], 0, __ATOMIC_ACQ_REL);
+    uint32_t clr = __atomic_exchange_n(&bank[MMIO_IO_CLR_DATAOUT / 4], 0, __ATOMIC_ACQ_REL);
+
+    uint32_t out = (bank[MMIO_IO_DATAOUT / 4] | set) & ~clr;
+    bank[MMIO_IO_DATAOUT / 4] = out;
+
+    // Outputs follow DATAOUT, inputs float high and any device may pull low
+    uint32_t oe = bank[MMIO_OE_ADDR / 4];
+    uint32_t pull = __atomic_load_n(&sim_pull_low[base], __ATOMIC_ACQUIRE);
+    uint32_t lines = ((out & ~oe) | oe) & ~pull;
+
+    __atomic_store_n(&bank[MMIO_IO_DATAIN / 4], lines, __ATOMIC_RELEASE);
+    return lines;
+}
+
+void mmio_sim_drive(int base, uint32_t mask, int lvl) {
+    if(lvl == LOW) {
+        __atomic_fetch_or(&sim_pull_low[base], mask, __ATOMIC_ACQ_REL);
+    } else {
+        __atomic_fetch_and(&sim_pull_low[base], ~mask, __ATOMIC_ACQ_REL);
+    }
+}
+
+int mmio_sim_fd(void) {
+    return sim_memfd;
+}
+//============================================================================//
@@ -0,0 +1,77 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    mmio_sim.h
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added simulated GPIO register file backend
+ *                  | v1.1.0 - Made usable from C++
+ *
+ * @note    The simulated backend maps an anonymous memfd laid out like the
+ *          AM335x gpio banks. Nothing updates the registers by itself, the
+ *          device model driving the lines must call mmio_sim_sync() to apply
+ *          SETDATAOUT/CLEARDATAOUT writes and refresh DATAIN.
+ *
+ * @sa      doc/..Technical_Reference_Manual.pdf
+ *
+ */
+
+#ifndef __MMIO_SIM_H__
+#define __MMIO_SIM_H__
+
+//===== INCLUDE ==============================================================//
+#include <stdint.h>
+
+#include "mmio.h"
+//============================================================================//
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//===== TYPES, CONSTANTS AND VARIABLES =======================================//
+extern const mmio_backend_t MMIO_BACKEND_SIM;
+//============================================================================//
+
+//===== FUNCTION DECLARATION =================================================//
+/*!
+ * @brief Applies pending SETDATAOUT/CLEARDATAOUT writes of a bank and
+ *        recomputes its DATAIN register from OE, DATAOUT and the lines pulled
+ *        low by simulated devices
+ * @param [base] int - Gpio base (0..3)
+ * @return [uint32_t] Resulting line levels of the bank
+ */
+uint32_t mmio_sim_sync(int base);
+
+/*!
+ * @brief Drives lines of a bank from a simulated device. Lines are open drain
+ *        with a pull-up, so a device can only pull them low or release them.
+ * @param [base] int - Gpio base (0..3)
+ * @param [mask] uint32_t - Lines driven by the device
+ * @param [lvl] int - LOW to pull the lines down, HIGH to release them
+ * @return None
+ */
+void mmio_sim_drive(int base, uint32_t mask, int lvl);
+
+/*!
+ * @brief Get the memfd holding the simulated register file, so other
+ *        processes can map it as well
+ * @param None
+ * @return File descriptor or negative value if not created yet
+ */
+int mmio_sim_fd(void);
+//============================================================================//
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //__MMIO_SIM_H__
@@ -0,0 +1,148 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    snapshot.c
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added state snapshot file
+ *
+ * @note    This is a library written in standard C to keep the state of the
+ *          application across restarts
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <fcntl.h>
+#include <libgen.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "snapshot.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+#define SNAPSHOT_PATH_MAX       256
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static uint32_t snapshot_check(const snapshot_header_t *header, const void *data) {
+    const uint8_t *bytes = (const uint8_t *) header;
+    uint32_t hash = 2166136261u;
+    for(size_t i = 0; i < offsetof(snapshot_header_t, check); i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+
+    bytes = (const uint8_t *) data;
+    for(uint32_t i = 0; i < header->size; i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static void snapshot_sync_dir(const char *path) {
+    // The rename is only durable once the directory entry is
+    char copy[SNAPSHOT_PATH_MAX];
+    snprintf(copy, sizeof(copy), "%s", path);
+    int fd = open(dirname(copy), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if(fd < 0) { return; }
+    fsync(fd);
+    close(fd);
+}
+
+int snapshot_write(const char *path, uint16_t payload, const void *data, uint32_t size) {
+    if(path == NULL || (data == NULL && size != 0)) { return SNAPSHOT_ERR_ARG; }
+
+    char tmp[SNAPSHOT_PATH_MAX];
+    if(snprintf(tmp, sizeof(tmp), "%s.tmp", path) >= (int) sizeof(tmp)) { return SNAPSHOT_ERR_ARG; }
+
+    snapshot_header_t header;
+    memset(&header, 0, sizeof(header));
+    header.magic = SNAPSHOT_MAGIC;
+    header.version = SNAPSHOT_VERSION;
+    header.payload = payload;
+    header.size = size;
+    header.time = (int64_t) time(NULL);
+    header.check = snapshot_check(&header, data);
+
+    int fd = open(tmp, O_CREAT | O_TRUNC | O_WRONLY | O_CLOEXEC, 0644);
+    if(fd < 0) { return SNAPSHOT_ERR_FILE; }
+
+    // Written aside and renamed, a crash never leaves a partial snapshot
+    struct iovec iov[2] = {
+        { .iov_base = &header, .iov_len = sizeof(header) },
+        { .iov_base = (void *) data, .iov_len = size }
+    };
+    ssize_t total = (ssize_t) (sizeof(header) + size);
+    int written = writev(fd, iov, 2) == total && fsync(fd) == 0;
+    written = close(fd) == 0 && written;
+    if(!written || rename(tmp, path) != 0) {
+        unlink(tmp);
+        return SNAPSHOT_ERR_FILE;
+    }
+
+    snapshot_sync_dir(path);
+    return SNAPSHOT_SUCCESS;
+}
+
+int snapshot_open(snapshot_t *snap, const char *path, uint16_t payload, uint32_t size) {
+    if(snap == NULL || path == NULL) { return SNAPSHOT_ERR_ARG; }
+    memset(snap, 0, sizeof(*snap));
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if(fd < 0) { return SNAPSHOT_ERR_FILE; }
+
+    struct stat st;
+    if(fstat(fd, &st) < 0) {
+        close(fd);
+        return SNAPSHOT_ERR_FILE;
+    }
+    if((size_t) st.st_size != sizeof(snapshot_header_t) + size) {
+        close(fd);
+        return SNAPSHOT_ERR_FORMAT;
+    }
+
+    void *map = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(map == MAP_FAILED) { return SNAPSHOT_ERR_FILE; }
+
+    const snapshot_header_t *header = map;
+    const void *data = (const uint8_t *) map + sizeof(snapshot_header_t);
+    int result = SNAPSHOT_SUCCESS;
+    if(header->magic != SNAPSHOT_MAGIC || header->version != SNAPSHOT_VERSION ||
+       header->payload != payload || header->size != size) {
+        result = SNAPSHOT_ERR_FORMAT;
+    } else if(header->check != snapshot_check(header, data)) {
+        result = SNAPSHOT_ERR_CHECK;
+    }
+    if(result != SNAPSHOT_SUCCESS) {
+        munmap(map, (size_t) st.st_size);
+        return result;
+    }
+
+    snap->map = map;
+    snap->length = (size_t) st.st_size;
+    snap->header = header;
+    snap->data = data;
+    return SNAPSHOT_SUCCESS;
+}
+
+void snapshot_close(snapshot_t *snap) {
+    if(snap == NULL || snap->map == NULL) { return; }
+
+    munmap(snap->map, snap->length);
+    memset(snap, 0, sizeof(*snap));
+}
+//============================================================================//
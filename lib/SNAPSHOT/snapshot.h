@@ -0,0 +1,96 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    snapshot.h
+ * @version v1.0.0 -- CHANGELOG
+ *                  | v1.0.0 - Added state snapshot file
+ *
+ * @note    A snapshot is one small binary file: a header with a magic, the
+ *          format and payload versions, the payload size, the wall clock
+ *          time it was taken and a checksum, followed by the payload the
+ *          application lays out. Writes go to a temporary file that is
+ *          synced and renamed over the old one, so a reader or a power cut
+ *          sees either the old snapshot or the new one. Reading maps the
+ *          file, nothing is parsed beyond the header.
+ *
+ */
+
+#ifndef __SNAPSHOT_H__
+#define __SNAPSHOT_H__
+
+//===== INCLUDE ==============================================================//
+#include <stddef.h>
+#include <stdint.h>
+//============================================================================//
+
+//===== TYPES, CONSTANTS AND VARIABLES =======================================//
+#define SNAPSHOT_MAGIC          0x50414E53  // "SNAP"
+#define SNAPSHOT_VERSION        1
+
+typedef enum SNAPSHOT_ERR {
+    SNAPSHOT_ERR_CHECK      = -4,
+    SNAPSHOT_ERR_FORMAT     = -3,
+    SNAPSHOT_ERR_FILE       = -2,
+    SNAPSHOT_ERR_ARG        = -1,
+    SNAPSHOT_SUCCESS        = 0
+} snapshot_err_e;
+
+typedef struct SNAPSHOT_HEADER {
+    uint32_t magic;
+    uint16_t version;           // Layout of this header
+    uint16_t payload;           // Layout of the payload, set by the application
+    int64_t time;               // Unix time the snapshot was taken
+    uint32_t size;              // Bytes of the payload
+    uint32_t check;             // FNV-1a of the header before it and the payload
+} snapshot_header_t;
+
+typedef struct SNAPSHOT {
+    void *map;
+    size_t length;
+    const snapshot_header_t *header;
+    const void *data;           // Payload inside the mapping
+} snapshot_t;
+//============================================================================//
+
+//===== FUNCTION DECLARATION =================================================//
+/*!
+ * @brief Replaces the snapshot file with a new payload, atomically and synced
+ *        to disk
+ * @param [path] char - File path
+ * @param [payload] uint16_t - Payload layout version
+ * @param [data] void - Payload
+ * @param [size] uint32_t - Bytes of the payload
+ * @return 0 if success else negative values for various possible errors
+ */
+int snapshot_write(const char *path, uint16_t payload, const void *data, uint32_t size);
+
+/*!
+ * @brief Maps a snapshot file read only and verifies it
+ * @param [snap] snapshot_t - Snapshot to open
+ * @param [path] char - File path
+ * @param [payload] uint16_t - Payload layout version expected
+ * @param [size] uint32_t - Payload size expected
+ * @return 0 if success, SNAPSHOT_ERR_FORMAT for another layout,
+ *         SNAPSHOT_ERR_CHECK if damaged else negative values for various
+ *         possible errors
+ */
+int snapshot_open(snapshot_t *snap, const char *path, uint16_t payload, uint32_t size);
+
+/*!
+ * @brief Unmaps a snapshot
+ * @param [snap] snapshot_t - Snapshot to close
+ * @return None
+ */
+void snapshot_close(snapshot_t *snap);
+//============================================================================//
+
+#endif //__SNAPSHOT_H__
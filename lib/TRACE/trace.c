@@ -0,0 +1,152 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    trace.c
+ * @version v1.1.0 -- CHANGELOG
+ *                  | v1.0.0 - Added trace points with per-thread rings
+ *                  | v1.1.0 - Cycle counter timestamps (TRACE_USE_PMCCNTR)
+ *
+ * @note    This is a library written in standard C to trace where time goes
+ *          on the mirror
+ *
+ * @sa      Trace Event Format -- JSON Object Format
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "trace.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+__thread trace_ring_t *trace_local = NULL;
+
+uint64_t trace_scale = 0;
+
+// Every ring ever attached, pushed lock free and never removed
+static trace_ring_t *trace_rings = NULL;
+
+static const char TRACE_PHASES[] = { 'B', 'E', 'i', 'C' };
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+trace_ring_t *trace_attach(void) {
+    if(trace_local != NULL) { return trace_local; }
+
+    trace_ring_t *ring = calloc(1, sizeof(*ring));
+    if(ring == NULL) { return NULL; }
+    ring->tid = (int32_t) syscall(SYS_gettid);
+
+    ring->next = __atomic_load_n(&trace_rings, __ATOMIC_RELAXED);
+    while(!__atomic_compare_exchange_n(&trace_rings, &ring->next, ring, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+    trace_local = ring;
+    return ring;
+}
+
+#if defined(TRACE_USE_PMCCNTR) && defined(__arm__)
+uint64_t trace_anchor(trace_ring_t *ring, uint64_t coarse_ns) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    uint32_t ticks = trace_ticks();
+    uint64_t ns = (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+
+    uint64_t span = ns - ring->anchor_ns;
+    if(ring->anchor_ns != 0 && span < TRACE_ANCHOR_NS) { return ns; }
+
+    // Anchors far enough apart for a precise rate and too close for the
+    // counter to have wrapped in between set the rate of every thread
+    if(ring->anchor_ns != 0 && span < TRACE_RATE_NS) {
+        __atomic_store_n(&trace_scale, (span << 32) / (uint32_t) (ticks - ring->anchor_ticks), __ATOMIC_RELAXED);
+    }
+    ring->anchor_ns = ns;
+    ring->anchor_coarse = coarse_ns;
+    ring->anchor_ticks = ticks;
+    return ns;
+}
+#endif
+
+void trace_thread_name(const char *name) {
+    trace_ring_t *ring = trace_attach();
+    if(ring != NULL) { __atomic_store_n(&ring->name, name, __ATOMIC_RELEASE); }
+}
+
+static void trace_string(FILE *file, const char *text) {
+    fputc('"', file);
+    for(; *text != '\0'; text++) {
+        if(*text == '"' || *text == '\\') { fputc('\\', file); }
+        if((unsigned char) *text >= 0x20) { fputc(*text, file); }
+    }
+    fputc('"', file);
+}
+
+static int trace_dump_ring(FILE *file, const trace_ring_t *ring, trace_event_t *copy, int pid, int first) {
+    const char *name = __atomic_load_n(&ring->name, __ATOMIC_ACQUIRE);
+    if(name != NULL) {
+        fprintf(file, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":",
+            first ? "" : ",", pid, ring->tid);
+        trace_string(file, name);
+        fputs("}}", file);
+        first = 0;
+    }
+
+    // Copied behind the writer, then whatever it may have overwritten in the
+    // meantime is dropped
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    uint32_t start = head > TRACE_EVENTS ? head - TRACE_EVENTS : 0;
+    for(uint32_t i = start; i != head; i++) { copy[i & (TRACE_EVENTS - 1)] = ring->events[i & (TRACE_EVENTS - 1)]; }
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    uint32_t now = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+    if(now - start >= TRACE_EVENTS) { start = now - TRACE_EVENTS + 1; }
+
+    for(uint32_t i = start; (int32_t) (head - i) > 0; i++) {
+        const trace_event_t *event = &copy[i & (TRACE_EVENTS - 1)];
+        fprintf(file, "%s\n{\"name\":", first ? "" : ",");
+        trace_string(file, event->name);
+        fprintf(file, ",\"ph\":\"%c\",\"ts\":%llu.%03u,\"pid\":%d,\"tid\":%d",
+            TRACE_PHASES[event->phase & 3], (unsigned long long) (event->time_ns / 1000),
+            (unsigned) (event->time_ns % 1000), pid, ring->tid);
+        if(event->phase == TRACE_PHASE_INSTANT) { fputs(",\"s\":\"t\"", file); }
+        if(event->phase == TRACE_PHASE_COUNTER) { fprintf(file, ",\"args\":{\"value\":%d}", (int) event->value); }
+        fputc('}', file);
+        first = 0;
+    }
+    return first;
+}
+
+int trace_dump(const char *path) {
+    if(path == NULL) { return TRACE_ERR_ARG; }
+
+    trace_event_t *copy = malloc(sizeof(trace_event_t) * TRACE_EVENTS);
+    if(copy == NULL) { return TRACE_ERR_FILE; }
+    FILE *file = fopen(path, "w");
+    if(file == NULL) {
+        free(copy);
+        return TRACE_ERR_FILE;
+    }
+
+    int pid = (int) getpid();
+    int first = 1;
+    fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", file);
+    const trace_ring_t *ring = __atomic_load_n(&trace_rings, __ATOMIC_ACQUIRE);
+    for(; ring != NULL; ring = ring->next) { first = trace_dump_ring(file, ring, copy, pid, first); }
+    fputs("\n]}\n", file);
+
+    free(copy);
+    return fclose(file) == 0 ? TRACE_SUCCESS : TRACE_ERR_FILE;
+}
+//============================================================================//
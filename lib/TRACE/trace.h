@@ -0,0 +1,217 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    trace.h
+ * @version v1.1.0 -- CHANGELOG
+ *                  | v1.0.0 - Added trace points with per-thread rings
+ *                  | v1.1.0 - Cycle counter timestamps (TRACE_USE_PMCCNTR)
+ *
+ * @note    Trace points mark where time goes, for a timeline in Chrome
+ *          (chrome://tracing) or Perfetto (ui.perfetto.dev):
+ *          - TRACE_BEGIN/TRACE_END around a span, TRACE_INSTANT for a point
+ *            in time and TRACE_COUNTER for a value over time
+ *          - without the TRACE_ENABLED build option the macros are empty and
+ *            nothing of the tracing is compiled into the callers
+ *          - an event is a clock read and a few stores into a ring owned
+ *            by the calling thread, no locks and no allocation after the
+ *            first event of a thread
+ *          - trace_dump() writes every ring as trace event JSON, from any
+ *            thread while the others keep tracing
+ *          Each ring keeps the last TRACE_EVENTS events of its thread, rings
+ *          stay allocated after their thread exits so it still shows in the
+ *          dump.
+ *
+ *          Names must be string literals or otherwise live for the whole
+ *          process, only the pointer is stored. Times are CLOCK_MONOTONIC
+ *          like dht_now_ns(). By default every event reads that clock, about
+ *          40 ns through the vDSO on a host with a vDSO clocksource, but a
+ *          full syscall on the AM335x, whose timers the vDSO can not read.
+ *          With the TRACE_USE_PMCCNTR build option an event reads the cycle
+ *          counter and the coarse clock (served from the vDSO data page on
+ *          any clocksource) instead. The cycles since an anchor of the
+ *          thread are scaled to ns by the rate measured between anchors, the
+ *          clock itself is read at most every TRACE_ANCHOR_NS per thread and
+ *          for every event until the rate is known. The counter is the one
+ *          of the current core, which is all of them on the AM335x, and its
+ *          user access must be enabled as for DHT_USE_PMCCNTR.
+ *
+ */
+
+#ifndef __TRACE_H__
+#define __TRACE_H__
+
+//===== INCLUDE ==============================================================//
+#include <stdint.h>
+#include <time.h>
+//============================================================================//
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//===== TYPES, CONSTANTS AND VARIABLES =======================================//
+#define TRACE_EVENTS            4096        // Per thread, a power of two
+#define TRACE_ANCHOR_NS         100000000ULL    // Span timed by cycles alone
+#define TRACE_RATE_NS           2000000000ULL   // Rate span, under a 1 GHz wrap
+
+typedef enum TRACE_ERR {
+    TRACE_ERR_FILE          = -2,
+    TRACE_ERR_ARG           = -1,
+    TRACE_SUCCESS           = 0
+} trace_err_e;
+
+typedef enum TRACE_PHASE {
+    TRACE_PHASE_BEGIN,
+    TRACE_PHASE_END,
+    TRACE_PHASE_INSTANT,
+    TRACE_PHASE_COUNTER
+} trace_phase_e;
+
+typedef struct TRACE_EVENT {
+    uint64_t time_ns;
+    const char *name;
+    int32_t value;                          // TRACE_COUNTER value
+    uint32_t phase;                         // trace_phase_e
+} trace_event_t;
+
+typedef struct TRACE_RING {
+    uint32_t head;                          // Events written, published last
+    int32_t tid;
+    const char *name;                       // Thread name, NULL for the tid
+    struct TRACE_RING *next;                // All rings, newest first
+    uint64_t anchor_ns;                     // Clock time of anchor_ticks
+    uint64_t anchor_coarse;                 // Coarse clock time of the anchor
+    uint32_t anchor_ticks;                  // Cycle counter at the anchor
+    trace_event_t events[TRACE_EVENTS];
+} trace_ring_t;
+
+extern __thread trace_ring_t *trace_local;
+
+// Ns per cycle in 32.32 fixed point, 0 until measured
+extern uint64_t trace_scale;
+
+#ifdef TRACE_ENABLED
+#define TRACE_BEGIN(name)           trace_event(TRACE_PHASE_BEGIN, (name), 0)
+#define TRACE_END(name)             trace_event(TRACE_PHASE_END, (name), 0)
+#define TRACE_INSTANT(name)         trace_event(TRACE_PHASE_INSTANT, (name), 0)
+#define TRACE_COUNTER(name, value)  trace_event(TRACE_PHASE_COUNTER, (name), (int32_t) (value))
+#define TRACE_THREAD(name)          trace_thread_name(name)
+#else
+#define TRACE_BEGIN(name)           ((void) 0)
+#define TRACE_END(name)             ((void) 0)
+#define TRACE_INSTANT(name)         ((void) 0)
+#define TRACE_COUNTER(name, value)  ((void) 0)
+#define TRACE_THREAD(name)          ((void) 0)
+#endif
+//============================================================================//
+
+//===== FUNCTION DECLARATION =================================================//
+/*!
+ * @brief Creates and registers the ring of the calling thread
+ * @param None
+ * @return Ring of the thread or NULL if out of memory
+ */
+trace_ring_t *trace_attach(void);
+
+/*!
+ * @brief Names the calling thread in the dump
+ * @param [name] char - Thread name, must live for the whole process
+ * @return None
+ */
+void trace_thread_name(const char *name);
+
+/*!
+ * @brief Writes the events of all threads as trace event JSON
+ * @param [path] char - Output file, replaced
+ * @return 0 if success else negative values for various possible errors
+ */
+int trace_dump(const char *path);
+
+#if defined(TRACE_USE_PMCCNTR) && defined(__arm__)
+/*!
+ * @brief Reads the ARM cycle counter, user access must be enabled
+ * @param None
+ * @return [uint32_t] Cycle count
+ */
+static inline uint32_t trace_ticks(void) {
+    uint32_t cycles;
+    __asm__ volatile("mrc p15, 0, %0, c9, c13, 0" : "=r"(cycles));
+    return cycles;
+}
+
+/*!
+ * @brief Reads the clock for an event the cycle counter can not time, moves
+ *        the anchor of the ring once it is TRACE_ANCHOR_NS old and measures
+ *        the cycle rate between two anchors
+ * @param [ring] trace_ring_t - Ring of the calling thread
+ * @param [coarse_ns] uint64_t - CLOCK_MONOTONIC_COARSE time of the event
+ * @return [uint64_t] CLOCK_MONOTONIC time in ns
+ */
+uint64_t trace_anchor(trace_ring_t *ring, uint64_t coarse_ns);
+#endif
+
+/*!
+ * @brief Time of an event of the calling thread
+ * @param [ring] trace_ring_t - Ring of the calling thread
+ * @return [uint64_t] CLOCK_MONOTONIC time in ns
+ */
+static inline uint64_t trace_now_ns(trace_ring_t *ring) {
+#if defined(TRACE_USE_PMCCNTR) && defined(__arm__)
+    // The coarse clock keeps the cycles since the anchor far from a wrap
+    uint32_t ticks = trace_ticks();
+    struct timespec coarse;
+    clock_gettime(CLOCK_MONOTONIC_COARSE, &coarse);
+    uint64_t coarse_ns = (uint64_t) coarse.tv_sec * 1000000000ULL + (uint64_t) coarse.tv_nsec;
+    uint64_t scale = __atomic_load_n(&trace_scale, __ATOMIC_RELAXED);
+    if(__builtin_expect(scale != 0 && coarse_ns - ring->anchor_coarse < TRACE_ANCHOR_NS, 1)) {
+        return ring->anchor_ns + (((uint64_t) (ticks - ring->anchor_ticks) * scale) >> 32);
+    }
+    return trace_anchor(ring, coarse_ns);
+#else
+    (void) ring;
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+#endif
+}
+
+/*!
+ * @brief Records an event in the ring of the calling thread. Use the TRACE_
+ *        macros, which vanish when tracing is not built in.
+ * @param [phase] trace_phase_e - Kind of event
+ * @param [name] char - Event name, must live for the whole process
+ * @param [value] int32_t - Value of a counter
+ * @return None
+ */
+static inline void trace_event(uint32_t phase, const char *name, int32_t value) {
+    trace_ring_t *ring = trace_local;
+    if(__builtin_expect(ring == NULL, 0)) {
+        ring = trace_attach();
+        if(ring == NULL) { return; }
+    }
+
+    // Only this thread writes the ring, the dump reads it behind head
+    uint32_t head = ring->head;
+    trace_event_t *event = &ring->events[head & (TRACE_EVENTS - 1)];
+    event->time_ns = trace_now_ns(ring);
+    event->name = name;
+    event->value = value;
+    event->phase = phase;
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+}
+//============================================================================//
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //__TRACE_H__
@@ -0,0 +1,445 @@
+/***
+ *      ___        ___       _   _                _ _            _
+ *     |  _|  /\  |_  |     | | | |              (_) |        /\| |/\
+ *     | |   /  \   | |_   _| |_| |__   ___  _ __ _| |_ _   _ \ ` ' / ______
+ *     | |  / /\ \  | | | | | __| '_ \ / _ \| '__| | __| | | |_     _|______|
+ *     | | / ____ \ | | |_| | |_| | | | (_) | |  | | |_| |_| |/ , . \
+ *     | |/_/    \_\| |\__,_|\__|_| |_|\___/|_|  |_|\__|\__, |\/|_|\/
+ *     |___|      |___|                                  __/ |
+ *                                                      |___/
+ *
+ * @author  Syed Asad Amin
+ * @date    Oct 16th, 2026
+ * @file    asset_pack.c
+ * @version v1.1.0 -- CHANGELOG
+ *                  | v1.0.0 - Added offline asset packer
+ *                  | v1.1.0 - Channel offsets of 32 bpp packs selectable
+ *
+ * @note    Converts images and fonts into one asset pack (display_pack.h)
+ *          in the pixel format of the framebuffer, so the mirror maps it and
+ *          never decodes anything. Every asset is given as name=source:
+ *          - an image from a binary PPM (P6) or, when built with libpng, a
+ *            PNG. Transparent pixels are blended over the background color.
+ *          - a font from a BDF file or from the built-in 5x7 glyphs of the
+ *            display ("builtin"), with @scale pixels per dot
+ *          32 bpp packs default to XRGB8888 (red at bit 16, green at 8, blue
+ *          at 0), -c sets other offsets and -d copies the whole format from
+ *          a framebuffer device. The mirror refuses a pack whose format is
+ *          not the one of its framebuffer.
+ *
+ *          The pack is written aside and renamed over the old one, a mirror
+ *          still mapping the old pack keeps it intact.
+ *
+ */
+
+//===== INCLUDE ==============================================================//
+#include <ctype.h>
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#ifdef ASSET_PACK_PNG
+#include <png.h>
+#endif
+
+#include "display.h"
+#include "display_pack.h"
+//============================================================================//
+
+//===== CONSTANTS AND VARIABLES ==============================================//
+#define PACK_ASSETS_MAX     64
+#define PACK_LINE_MAX       256
+#define PACK_PATH_MAX       256
+
+typedef struct PACK_ASSET {
+    display_pack_entry_t entry;
+    uint8_t *data;              // entry.size bytes, offset set when written
+} pack_asset_t;
+
+typedef struct PACK_RGBA {
+    uint32_t width;
+    uint32_t height;
+    uint8_t *pixels;            // 8 bit red, green, blue, alpha
+} pack_rgba_t;
+//============================================================================//
+
+//===== FUNCTION DEFINITION ==================================================//
+static void pack_put(uint8_t *p, uint32_t bytes, uint32_t pixel) {
+    if(bytes == 2) {
+        *(uint16_t *) p = (uint16_t) pixel;
+    } else {
+        *(uint32_t *) p = pixel;
+    }
+}
+
+static int pack_token(FILE *file, char *token, size_t size) {
+    // Netpbm headers are whitespace separated with # comments
+    int c;
+    size_t len = 0;
+    do {
+        c = fgetc(file);
+        if(c == '#') {
+            while(c != '\n' && c != EOF) { c = fgetc(file); }
+        }
+    } while(c != EOF && isspace(c));
+    while(c != EOF && !isspace(c) && len + 1 < size) {
+        token[len++] = (char) c;
+        c = fgetc(file);
+    }
+    token[len] = '\0';
+    return len > 0;
+}
+
+static int pack_read_ppm(pack_rgba_t *rgba, const char *path) {
+    FILE *file = fopen(path, "rb");
+    if(file == NULL) { return -1; }
+
+    char magic[8], width[16], height[16], max[16];
+    int ok = pack_token(file, magic, sizeof(magic)) && strcmp(magic, "P6") == 0 &&
+        pack_token(file, width, sizeof(width)) && pack_token(file, height, sizeof(height)) &&
+        pack_token(file, max, sizeof(max)) && atoi(max) == 255;
+    rgba->width = ok ? (uint32_t) atoi(width) : 0;
+    rgba->height = ok ? (uint32_t) atoi(height) : 0;
+    if(rgba->width == 0 || rgba->height == 0 || rgba->width > 8192 || rgba->height > 8192) {
+        fclose(file);
+        return -1;
+    }
+
+    const size_t count = (size_t) rgba->width * rgba->height;
+    rgba->pixels = malloc(count * 4);
+    size_t i = 0;
+    for(; rgba->pixels != NULL && i < count; i++) {
+        if(fread(&rgba->pixels[i * 4], 1, 3, file) != 3) { break; }
+        rgba->pixels[i * 4 + 3] = 0xFF;
+    }
+    fclose(file);
+    return rgba->pixels != NULL && i == count ? 0 : -1;
+}
+
+static int pack_read_png(pack_rgba_t *rgba, const char *path) {
+#ifdef ASSET_PACK_PNG
+    png_image png;
+    memset(&png, 0, sizeof(png));
+    png.version = PNG_IMAGE_VERSION;
+    if(!png_image_begin_read_from_file(&png, path)) { return -1; }
+
+    png.format = PNG_FORMAT_RGBA;
+    rgba->width = png.width;
+    rgba->height = png.height;
+    rgba->pixels = malloc(PNG_IMAGE_SIZE(png));
+    if(rgba->pixels == NULL) {
+        png_image_free(&png);
+        return -1;
+    }
+    return png_image_finish_read(&png, NULL, rgba->pixels, 0, NULL) ? 0 : -1;
+#else
+    (void) rgba;
+    fprintf(stderr, "%s: built without libpng, convert it to PPM\n", path);
+    return -1;
+#endif
+}
+
+static int pack_image(pack_asset_t *asset, const display_t *disp, const char *path, uint32_t bg) {
+    pack_rgba_t rgba = { 0, 0, NULL };
+    const char *ext = strrchr(path, '.');
+    int result = ext != NULL && strcmp(ext, ".png") == 0 ? pack_read_png(&rgba, path) : pack_read_ppm(&rgba, path);
+    if(result != 0) {
+        free(rgba.pixels);
+        return -1;
+    }
+
+    // Rows padded to 32 bits
+    display_pack_entry_t *entry = &asset->entry;
+    entry->type = DISPLAY_ASSET_IMAGE;
+    entry->width = rgba.width;
+    entry->height = rgba.height;
+    entry->stride = (rgba.width * disp->bytes + 3) & ~3u;
+    entry->size = entry->stride * entry->height;
+    asset->data = calloc(1, entry->size);
+    if(asset->data == NULL) {
+        free(rgba.pixels);
+        return -1;
+    }
+
+    for(uint32_t y = 0; y < rgba.height; y++) {
+        for(uint32_t x = 0; x < rgba.width; x++) {
+            const uint8_t *p = &rgba.pixels[((size_t) y * rgba.width + x) * 4];
+            uint32_t rgb = 0;
+            for(int c = 0; c < 3; c++) {
+                uint32_t under = (bg >> (16 - 8 * c)) & 0xFF;
+                uint32_t value = (p[c] * p[3] + under * (255u - p[3]) + 127) / 255;
+                rgb |= value << (16 - 8 * c);
+            }
+            pack_put(asset->data + (size_t) y * entry->stride + (size_t) x * disp->bytes, disp->bytes,
+                display_color(disp, rgb));
+        }
+    }
+    free(rgba.pixels);
+    return 0;
+}
+
+static int pack_font_alloc(pack_asset_t *asset, const display_t *disp, uint32_t width, uint32_t height,
+    uint32_t glyphs, uint32_t bg) {
+    display_pack_entry_t *entry = &asset->entry;
+    entry->type = DISPLAY_ASSET_FONT;
+    entry->width = width;
+    entry->height = height;
+    entry->stride = width * disp->bytes;
+    entry->glyphs = glyphs;
+    entry->bg = display_color(disp, bg);
+    entry->size = DISPLAY_PACK_INDEX + entry->stride * height * glyphs;
+    asset->data = calloc(1, entry->size);
+    return asset->data != NULL ? 0 : -1;
+}
+
+static int pack_font_builtin(pack_asset_t *asset, const display_t *disp, uint32_t scale, uint32_t fg, uint32_t bg) {
+    display_font_t font;
+    if(display_font_init(&font, disp, scale, fg, bg) != DISPLAY_SUCCESS) { return -1; }
+
+    // The very atlas the display would rasterize at startup
+    int result = pack_font_alloc(asset, disp, font.width, font.height, (uint32_t) font.glyphs, bg);
+    if(result == 0) {
+        memcpy(asset->data, font.index, DISPLAY_PACK_INDEX);
+        memcpy(asset->data + DISPLAY_PACK_INDEX, font.atlas, asset->entry.size - DISPLAY_PACK_INDEX);
+    }
+    display_font_free(&font);
+    return result;
+}
+
+static int pack_font_bdf(pack_asset_t *asset, const display_t *disp, const char *path, uint32_t scale,
+    uint32_t fg, uint32_t bg) {
+    FILE *file = fopen(path, "r");
+    if(file == NULL) { return -1; }
+
+    // Cell and glyph count first, the bitmaps on a second pass
+    char line[PACK_LINE_MAX];
+    int fw = 0, fh = 0, fx = 0, fy = 0;
+    uint32_t glyphs = 0;
+    int fallback = '?';
+    while(fgets(line, sizeof(line), file) != NULL) {
+        int code;
+        if(sscanf(line, "FONTBOUNDINGBOX %d %d %d %d", &fw, &fh, &fx, &fy) == 4) { continue; }
+        if(sscanf(line, "DEFAULT_CHAR %d", &code) == 1 && code >= 0 && code < 256) { fallback = code; }
+        if(sscanf(line, "ENCODING %d", &code) == 1 && code >= 0 && code < 256) { glyphs++; }
+    }
+    if(fw <= 0 || fh <= 0 || glyphs == 0 || glyphs > 256 ||
+       pack_font_alloc(asset, disp, (uint32_t) fw * scale, (uint32_t) fh * scale, glyphs, bg) != 0) {
+        fclose(file);
+        return -1;
+    }
+
+    const display_pack_entry_t *entry = &asset->entry;
+    const size_t cell = (size_t) entry->stride * entry->height;
+    const uint32_t fg_px = display_color(disp, fg);
+    uint8_t *atlas = asset->data + DISPLAY_PACK_INDEX;
+    for(size_t i = 0; i < cell * glyphs; i += disp->bytes) { pack_put(atlas + i, disp->bytes, entry->bg); }
+
+    int slots[256];
+    for(int c = 0; c < 256; c++) { slots[c] = -1; }
+    rewind(file);
+    int next = 0;
+    int slot = -1;
+    int w = 0, h = 0, x = 0, y = 0, row = -1;
+    while(fgets(line, sizeof(line), file) != NULL) {
+        int code;
+        if(sscanf(line, "ENCODING %d", &code) == 1) {
+            slot = -1;
+            if(code >= 0 && code < 256) { slot = slots[code] = next++; }
+            row = -1;
+        } else if(sscanf(line, "BBX %d %d %d %d", &w, &h, &x, &y) == 4) {
+            row = -1;
+        } else if(strncmp(line, "BITMAP", 6) == 0) {
+            row = 0;
+        } else if(strncmp(line, "ENDCHAR", 7) == 0) {
+            row = -1;
+        } else if(row >= 0 && slot >= 0) {
+            // Hex bytes of one row, leftmost dot in the top bit
+            unsigned long bits = strtoul(line, NULL, 16);
+            int digits = (int) strspn(line, "0123456789abcdefABCDEF");
+            int top = fh + fy - (y + h) + row++;
+            for(int col = 0; col < w && col < digits * 4; col++) {
+                int left = x - fx + col;
+                if(!((bits >> (digits * 4 - 1 - col)) & 1) || left < 0 || left >= fw || top < 0 || top >= fh) {
+                    continue;
+                }
+                for(uint32_t sy = 0; sy < scale; sy++) {
+                    uint8_t *out = atlas + (size_t) slot * cell + ((size_t) top * scale + sy) * entry->stride;
+                    for(uint32_t sx = 0; sx < scale; sx++) {
+                        pack_put(out + ((size_t) left * scale + sx) * disp->bytes, disp->bytes, fg_px);
+                    }
+                }
+            }
+        }
+    }
+    fclose(file);
+
+    // Characters without a glyph show the default one
+    int missing = slots[fallback] >= 0 ? slots[fallback] : 0;
+    for(int c = 0; c < 256; c++) { asset->data[c] = (uint8_t) (slots[c] >= 0 ? slots[c] : missing); }
+    return 0;
+}
+
+static int pack_add(pack_asset_t *asset, const display_t *disp, const char *spec, uint32_t fg, uint32_t bg) {
+    char copy[PACK_PATH_MAX];
+    snprintf(copy, sizeof(copy), "%s", spec);
+    char *source = strchr(copy, '=');
+    if(source == NULL || source == copy || (size_t) (source - copy) >= DISPLAY_PACK_NAME_MAX) { return -1; }
+    *source++ = '\0';
+
+    memset(asset, 0, sizeof(*asset));
+    strcpy(asset->entry.name, copy);
+
+    // Fonts take a scale, images are used at their size
+    char *at = strrchr(source, '@');
+    uint32_t scale = 1;
+    if(at != NULL) {
+        *at = '\0';
+        scale = (uint32_t) atoi(at + 1);
+        if(scale == 0 || scale > 64) { return -1; }
+    }
+    const char *ext = strrchr(source, '.');
+    if(strcmp(source, "builtin") == 0) { return pack_font_builtin(asset, disp, scale, fg, bg); }
+    if(ext != NULL && strcmp(ext, ".bdf") == 0) { return pack_font_bdf(asset, disp, source, scale, fg, bg); }
+    return pack_image(asset, disp, source, bg);
+}
+
+static uint32_t pack_align(uint32_t offset) {
+    return (offset + DISPLAY_PACK_ALIGN - 1) & ~(uint32_t) (DISPLAY_PACK_ALIGN - 1);
+}
+
+static int pack_pad(FILE *file, uint32_t to) {
+    static const uint8_t zeros[DISPLAY_PACK_ALIGN];
+    long at = ftell(file);
+    size_t len = at >= 0 && (uint32_t) at < to ? to - (uint32_t) at : 0;
+    return at >= 0 && fwrite(zeros, 1, len, file) == len;
+}
+
+static int pack_write(const char *path, const display_t *disp, pack_asset_t *assets, int count) {
+    display_pack_entry_t toc[PACK_ASSETS_MAX];
+
+    // Header, table, then every asset on an aligned offset
+    display_pack_header_t header;
+    memset(&header, 0, sizeof(header));
+    header.magic = DISPLAY_PACK_MAGIC;
+    header.version = DISPLAY_PACK_VERSION;
+    header.bytes = (uint16_t) disp->bytes;
+    memcpy(header.shift, disp->shift, sizeof(disp->shift));
+    header.assets = (uint32_t) count;
+    header.toc = pack_align(sizeof(header));
+    uint32_t offset = pack_align(header.toc + (uint32_t) (count * (int) sizeof(display_pack_entry_t)));
+    for(int i = 0; i < count; i++) {
+        assets[i].entry.offset = offset;
+        toc[i] = assets[i].entry;
+        offset = pack_align(offset + assets[i].entry.size);
+    }
+    header.size = offset;
+    header.check = display_pack_check(&header, toc);
+
+    char tmp[PACK_PATH_MAX];
+    if(snprintf(tmp, sizeof(tmp), "%s.tmp", path) >= (int) sizeof(tmp)) { return -1; }
+    FILE *file = fopen(tmp, "wb");
+    if(file == NULL) { return -1; }
+
+    int ok = fwrite(&header, sizeof(header), 1, file) == 1 && pack_pad(file, header.toc) &&
+        fwrite(toc, sizeof(display_pack_entry_t), (size_t) count, file) == (size_t) count;
+    for(int i = 0; ok && i < count; i++) {
+        ok = pack_pad(file, assets[i].entry.offset) &&
+            fwrite(assets[i].data, 1, assets[i].entry.size, file) == assets[i].entry.size;
+    }
+    ok = ok && pack_pad(file, header.size);
+    ok = fclose(file) == 0 && ok;
+    if(!ok || rename(tmp, path) != 0) {
+        unlink(tmp);
+        return -1;
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    const char *out = "mirror.pack";
+    uint32_t bpp = 16;
+    uint32_t fg = 0xFFFFFF;
+    uint32_t bg = 0x000000;
+    int shift[3] = { 16, 8, 0 };
+    const char *device = NULL;
+
+    int opt;
+    while((opt = getopt(argc, argv, "o:b:c:d:f:k:h")) != -1) {
+        switch(opt) {
+        case 'o': out = optarg; break;
+        case 'b': bpp = (uint32_t) atoi(optarg); break;
+        case 'f': fg = (uint32_t) strtoul(optarg, NULL, 16); break;
+        case 'k': bg = (uint32_t) strtoul(optarg, NULL, 16); break;
+        case 'c':
+            if(sscanf(optarg, "%d,%d,%d", &shift[0], &shift[1], &shift[2]) != 3) { shift[0] = -1; }
+            break;
+        case 'd': device = optarg; break;
+        default:
+            fprintf(stderr,
+                "Usage: %s [options] name=source[@scale]...\n"
+                "  -o <pack>     Pack to write (default mirror.pack)\n"
+                "  -b <bpp>      16 (RGB565) or 32 bits per pixel (default 16)\n"
+                "  -c <r,g,b>    Bit offsets of the 32 bpp channels (default 16,8,0)\n"
+                "  -d <fbdev>    Take bpp and offsets from a framebuffer, e.g. /dev/fb0\n"
+                "  -f <rrggbb>   Glyph color of fonts (default FFFFFF)\n"
+                "  -k <rrggbb>   Background of fonts and transparent pixels (default 000000)\n"
+                "Sources are .ppm or .png images, .bdf fonts or builtin for the 5x7 font\n",
+                argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    int count = argc - optind;
+    if(count <= 0 || count > PACK_ASSETS_MAX) {
+        fprintf(stderr, "Expected 1 to %d assets\n", PACK_ASSETS_MAX);
+        return EXIT_FAILURE;
+    }
+
+    // A one pixel display only lends its pixel format
+    display_t disp;
+    if(device != NULL) {
+        if(display_open(&disp, device) != DISPLAY_SUCCESS) {
+            fprintf(stderr, "Failed to open %s\n", device);
+            return EXIT_FAILURE;
+        }
+    } else if(display_open_memory(&disp, 1, 1, bpp) != DISPLAY_SUCCESS) {
+        fprintf(stderr, "Unsupported %u bpp\n", bpp);
+        return EXIT_FAILURE;
+    } else if(disp.bytes == 4) {
+        for(int c = 0; c < 3; c++) {
+            if(shift[c] < 0 || shift[c] > 24 || shift[c] % 8 != 0) {
+                fprintf(stderr, "Channel offsets are 0, 8, 16 or 24\n");
+                display_close(&disp);
+                return EXIT_FAILURE;
+            }
+            disp.shift[c] = (uint8_t) shift[c];
+        }
+    }
+
+    static pack_asset_t assets[PACK_ASSETS_MAX];
+    int result = EXIT_SUCCESS;
+    for(int i = 0; i < count && result == EXIT_SUCCESS; i++) {
+        if(pack_add(&assets[i], &disp, argv[optind + i], fg, bg) != 0) {
+            fprintf(stderr, "Failed to convert %s\n", argv[optind + i]);
+            result = EXIT_FAILURE;
+        }
+    }
+    if(result == EXIT_SUCCESS && pack_write(out, &disp, assets, count) != 0) {
+        fprintf(stderr, "Failed to write %s\n", out);
+        result = EXIT_FAILURE;
+    }
+
+    for(int i = 0; i < count; i++) {
+        if(result == EXIT_SUCCESS) {
+            const display_pack_entry_t *entry = &assets[i].entry;
+            fprintf(stdout, "  %-16s %-5s %4ux%-4u %8u bytes at %u\n", entry->name,
+                entry->type == DISPLAY_ASSET_FONT ? "font" : "image", entry->width, entry->height, entry->size,
+                entry->offset);
+        }
+        free(assets[i].data);
+    }
+    display_close(&disp);
+    return result;
+}
+//============================================================================//